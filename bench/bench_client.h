@@ -0,0 +1,85 @@
+#pragma once
+
+// the client side of the benches that run R code on a running haRness. they
+// only talk to it over gRPC, start the server the way it is measured (e.g.
+// HARNESS_RENDER_HELPERS=0) before running them
+
+#include "bench_util.h"
+#include "reval_service.grpc.pb.h"
+
+#include <chrono>
+#include <grpcpp/grpcpp.h>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <thread>
+
+namespace bench {
+
+// what main.cpp listens on
+constexpr const char *default_address = "localhost:50051";
+
+inline std::unique_ptr<REvalService::Stub> connect(int argc, char **argv,
+                                                   int index) {
+  std::string address = index < argc ? argv[index] : default_address;
+  return REvalService::NewStub(
+      grpc::CreateChannel(address, grpc::InsecureChannelCredentials()));
+}
+
+inline void check(const grpc::Status &status, const char *what) {
+  if (!status.ok()) {
+    throw std::runtime_error(std::string(what) + " failed: " +
+                             status.error_message());
+  }
+}
+
+// the name of the operation
+inline std::string submit(REvalService::Stub &stub, const std::string &code,
+                          const std::string &session_id) {
+  EvalRScriptRequest request;
+  request.set_r_code(code);
+  request.set_session_id(session_id);
+  EvalOperation operation;
+  grpc::ClientContext context;
+  check(stub.EvalRScript(&context, request, &operation), "EvalRScript");
+  return operation.name();
+}
+
+// polls every poll_interval until the operation is done. plots by reference
+// and compressed output, the benches don't look at the output and shouldn't
+// time its transfer
+inline EvalOperation
+wait_done(REvalService::Stub &stub, const std::string &name,
+          std::chrono::milliseconds poll_interval =
+              std::chrono::milliseconds(1)) {
+  GetEvalOperationRequest request;
+  request.set_name(name);
+  request.add_accept_encodings(CONTENT_ENCODING_ZSTD);
+  request.set_plots_by_reference(true);
+  while (true) {
+    EvalOperation operation;
+    grpc::ClientContext context;
+    check(stub.GetEvalOperation(&context, request, &operation),
+          "GetEvalOperation");
+    if (operation.done()) {
+      return operation;
+    }
+    std::this_thread::sleep_for(poll_interval);
+  }
+}
+
+// submit to done, as a client sees it
+inline std::chrono::nanoseconds run(REvalService::Stub &stub,
+                                    const std::string &code,
+                                    const std::string &session_id,
+                                    EvalOperation *result = nullptr) {
+  auto start = std::chrono::steady_clock::now();
+  EvalOperation operation = wait_done(stub, submit(stub, code, session_id));
+  auto elapsed = std::chrono::steady_clock::now() - start;
+  if (result != nullptr) {
+    *result = std::move(operation);
+  }
+  return elapsed;
+}
+
+} // namespace bench
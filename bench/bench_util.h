@@ -0,0 +1,66 @@
+#pragma once
+
+// small helpers shared by the bench/ executables. no framework, each bench is
+// a main() that prints its numbers, see NOTES.md for how they were run
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+namespace bench {
+
+// samples in microseconds, summarized as count/p50/p99/max
+class LatencySamples {
+public:
+  void add(std::chrono::nanoseconds sample) {
+    samples_us_.push_back(
+        std::chrono::duration<double, std::micro>(sample).count());
+  }
+
+  std::size_t size() const { return samples_us_.size(); }
+
+  void merge(const LatencySamples &other) {
+    samples_us_.insert(samples_us_.end(), other.samples_us_.begin(),
+                       other.samples_us_.end());
+  }
+
+  // nearest-rank percentile, 0 if there are no samples
+  double percentile(double p) {
+    if (samples_us_.empty()) {
+      return 0;
+    }
+    std::sort(samples_us_.begin(), samples_us_.end());
+    auto rank = static_cast<std::size_t>(p / 100.0 * samples_us_.size());
+    return samples_us_[std::min(rank, samples_us_.size() - 1)];
+  }
+
+  void print(const std::string &label) {
+    std::printf("%-28s n=%-6zu p50=%10.1fus p99=%10.1fus max=%10.1fus\n",
+                label.c_str(), size(), percentile(50), percentile(99),
+                percentile(100));
+  }
+
+private:
+  std::vector<double> samples_us_;
+};
+
+// keeps the compiler from dropping a computation whose result is unused
+template <typename T> inline void do_not_optimize(T &value) {
+  asm volatile("" : : "r,m"(value) : "memory");
+}
+
+// a positive integer from argv[index], fallback if it isn't there
+inline std::size_t size_arg(int argc, char **argv, int index,
+                            std::size_t fallback) {
+  if (index >= argc) {
+    return fallback;
+  }
+  long value = std::strtol(argv[index], nullptr, 10);
+  return value > 0 ? static_cast<std::size_t>(value) : fallback;
+}
+
+} // namespace bench
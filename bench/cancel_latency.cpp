@@ -0,0 +1,86 @@
+// cancel-to-idle: how long after CancelEvalOperation the session's worker
+// runs the next task. for each case the code is submitted, cancelled once it
+// has run for cancel_after, then NULL is submitted to the same session. two
+// numbers per cancel:
+//   done  CancelEvalOperation to the operation polling as done
+//   idle  CancelEvalOperation to the NULL task polling as done, so it
+//         includes running NULL
+//
+// the long C call is a LINPACK QR, which never checks for interrupts. its
+// numbers are however much of the call is left when the cancel comes, on
+// the machine it runs on
+//
+// needs a running haRness
+//
+// usage: cancel_latency [address, default localhost:50051] [runs, default 5]
+//                       [cancel_after_ms, default 500]
+
+#include "bench_client.h"
+
+#include <chrono>
+#include <cstdio>
+#include <exception>
+#include <string>
+#include <thread>
+
+namespace {
+
+struct CancelCase {
+  const char *label;
+  const char *code;
+};
+
+constexpr CancelCase cases[] = {
+    {"busy loop", "while (TRUE) {}"},
+    {"Sys.sleep", "Sys.sleep(600)"},
+    {"long C call", "invisible(qr(matrix(runif(4e6), 2000), LAPACK = FALSE))"},
+};
+
+constexpr const char *session_id = "bench-cancel";
+
+} // namespace
+
+int main(int argc, char **argv) {
+  std::size_t runs = bench::size_arg(argc, argv, 2, 5);
+  std::chrono::milliseconds cancel_after(
+      bench::size_arg(argc, argv, 3, 500));
+
+  try {
+    auto stub = bench::connect(argc, argv, 1);
+    // places the session on its worker
+    bench::run(*stub, "NULL", session_id);
+
+    for (const CancelCase &cancel_case : cases) {
+      bench::LatencySamples to_done;
+      bench::LatencySamples to_idle;
+      for (std::size_t i = 0; i < runs; ++i) {
+        std::string name = bench::submit(*stub, cancel_case.code, session_id);
+        std::this_thread::sleep_for(cancel_after);
+
+        auto start = std::chrono::steady_clock::now();
+        CancelEvalOperationRequest request;
+        request.set_name(name);
+        google::protobuf::Empty empty;
+        grpc::ClientContext context;
+        bench::check(stub->CancelEvalOperation(&context, request, &empty),
+                     "CancelEvalOperation");
+
+        EvalOperation operation = bench::wait_done(*stub, name);
+        to_done.add(std::chrono::steady_clock::now() - start);
+        if (operation.eval_result().status() != EVAL_CANCELLED) {
+          std::fprintf(stderr, "%s: ended with status %d, not cancelled\n",
+                       cancel_case.label, operation.eval_result().status());
+        }
+
+        bench::run(*stub, "NULL", session_id);
+        to_idle.add(std::chrono::steady_clock::now() - start);
+      }
+      to_done.print(std::string(cancel_case.label) + " done");
+      to_idle.print(std::string(cancel_case.label) + " idle");
+    }
+  } catch (const std::exception &e) {
+    std::fprintf(stderr, "%s\n", e.what());
+    return 1;
+  }
+  return 0;
+}
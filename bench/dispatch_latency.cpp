@@ -0,0 +1,172 @@
+// submit-to-start latency of a task, from RTask creation to the R thread
+// taking it off its queue. three ways:
+//   poll      the old r_worker_thread loop, try_dequeue and a 5ms sleep when
+//             the queue was empty
+//   scheduler RTaskScheduler, what the worker process' R thread waits on
+//   ipc       the whole worker path: serialize_task, a frame over a
+//             socketpair, a reader thread deserializing it into the
+//             scheduler, then the R thread's wait_pop
+//
+// one task at a time with 0-2ms between them, like an agent sending one
+// snippet after the other. no R involved, only the dispatch
+//
+// usage: dispatch_latency [samples per mode, default 2000]
+
+#include "bench_util.h"
+#include "r_ipc.h"
+#include "r_task.h"
+#include "r_task_scheduler.h"
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <random>
+#include <stop_token>
+#include <sys/socket.h>
+#include <thread>
+#include <unistd.h>
+
+using namespace RWorker;
+
+namespace {
+
+std::unique_ptr<RTask> make_task() {
+  return RTask::create_client_r_code_task("1 + 1");
+}
+
+// the R thread's side: records when each task came off the queue and lets
+// the submitter know
+class Starts {
+public:
+  void started(const RTask &task) {
+    auto now = std::chrono::steady_clock::now();
+    std::lock_guard<std::mutex> lock(mutex_);
+    samples_.add(now - task.get_created_at());
+    ++started_;
+    changed_.notify_one();
+  }
+
+  void wait_for(std::size_t count) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    changed_.wait(lock, [&] { return started_ >= count; });
+  }
+
+  bench::LatencySamples &samples() { return samples_; }
+
+private:
+  std::mutex mutex_;
+  std::condition_variable changed_;
+  std::size_t started_ = 0;
+  bench::LatencySamples samples_;
+};
+
+// submits samples tasks one after the other, each once the last started
+void drive(std::size_t samples, Starts &starts,
+           const std::function<void(std::unique_ptr<RTask>)> &submit) {
+  std::mt19937 rng(42);
+  std::uniform_int_distribution<int> think_us(0, 2000);
+  for (std::size_t i = 0; i < samples; ++i) {
+    std::this_thread::sleep_for(std::chrono::microseconds(think_us(rng)));
+    submit(make_task());
+    starts.wait_for(i + 1);
+  }
+}
+
+void bench_poll(std::size_t samples) {
+  std::mutex mutex;
+  std::deque<std::unique_ptr<RTask>> queue;
+  Starts starts;
+
+  std::jthread r_thread([&](std::stop_token stop_token) {
+    while (!stop_token.stop_requested()) {
+      std::unique_ptr<RTask> task;
+      {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (!queue.empty()) {
+          task = std::move(queue.front());
+          queue.pop_front();
+        }
+      }
+      if (!task) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+        continue;
+      }
+      starts.started(*task);
+    }
+  });
+
+  drive(samples, starts, [&](std::unique_ptr<RTask> task) {
+    std::lock_guard<std::mutex> lock(mutex);
+    queue.push_back(std::move(task));
+  });
+  starts.samples().print("poll (5ms sleep)");
+}
+
+void bench_scheduler(std::size_t samples) {
+  RTaskScheduler scheduler;
+  Starts starts;
+
+  std::jthread r_thread([&](std::stop_token stop_token) {
+    while (!stop_token.stop_requested()) {
+      std::unique_ptr<RTask> task;
+      if (scheduler.wait_pop(task, std::chrono::milliseconds(100))) {
+        starts.started(*task);
+      }
+    }
+  });
+
+  drive(samples, starts, [&](std::unique_ptr<RTask> task) {
+    scheduler.push(std::move(task));
+  });
+  starts.samples().print("RTaskScheduler");
+}
+
+void bench_ipc(std::size_t samples) {
+  int fds[2];
+  if (socketpair(AF_UNIX, SOCK_STREAM, 0, fds) != 0) {
+    std::perror("socketpair");
+    return;
+  }
+
+  RTaskScheduler scheduler;
+  Starts starts;
+
+  std::jthread reader([&] {
+    Frame frame;
+    while (read_frame(fds[1], frame)) {
+      bool wants_events = false;
+      scheduler.push(deserialize_task(frame.payload, wants_events));
+    }
+  });
+  std::jthread r_thread([&](std::stop_token stop_token) {
+    while (!stop_token.stop_requested()) {
+      std::unique_ptr<RTask> task;
+      if (scheduler.wait_pop(task, std::chrono::milliseconds(100))) {
+        starts.started(*task);
+      }
+    }
+  });
+
+  drive(samples, starts, [&](std::unique_ptr<RTask> task) {
+    write_frame(fds[0], FrameType::TASK, serialize_task(*task));
+  });
+  starts.samples().print("socketpair + RTaskScheduler");
+
+  // EOF for the reader
+  shutdown(fds[0], SHUT_RDWR);
+  reader.join();
+  close(fds[0]);
+  close(fds[1]);
+}
+
+} // namespace
+
+int main(int argc, char **argv) {
+  std::size_t samples = bench::size_arg(argc, argv, 1, 2000);
+  bench_poll(samples);
+  bench_scheduler(samples);
+  bench_ipc(samples);
+  return 0;
+}
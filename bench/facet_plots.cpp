@@ -0,0 +1,55 @@
+// a snippet that makes 8 facetted ggplots, submit to done as a client sees
+// it. run it against a server with HARNESS_RENDER_HELPERS=0 (rendered on the
+// R thread) and one with render helpers to compare
+//
+// needs a running haRness with ggplot2 installed. one warmup run, which also
+// loads ggplot2 into the session, then runs timed runs
+//
+// usage: facet_plots [address, default localhost:50051] [runs, default 5]
+
+#include "bench_client.h"
+
+#include <cstdio>
+#include <exception>
+#include <string>
+
+namespace {
+
+constexpr const char *facet_code = R"(
+library(ggplot2)
+for (i in 1:8) {
+  print(ggplot(mpg, aes(displ, hwy, colour = drv)) +
+    geom_point() +
+    geom_smooth(method = "lm", formula = y ~ x) +
+    facet_wrap(~class) +
+    ggtitle(paste("plot", i)))
+}
+)";
+
+} // namespace
+
+int main(int argc, char **argv) {
+  std::size_t runs = bench::size_arg(argc, argv, 2, 5);
+
+  try {
+    auto stub = bench::connect(argc, argv, 1);
+    EvalOperation operation;
+    bench::run(*stub, facet_code, "bench-facet-plots", &operation);
+    const EvalResult &result = operation.eval_result();
+    if (result.status() != EVAL_SUCCESS || result.plot_refs_size() != 8) {
+      std::fprintf(stderr, "expected 8 plots, got status %d and %d plots\n",
+                   result.status(), result.plot_refs_size());
+      return 1;
+    }
+
+    bench::LatencySamples samples;
+    for (std::size_t i = 0; i < runs; ++i) {
+      samples.add(bench::run(*stub, facet_code, "bench-facet-plots"));
+    }
+    samples.print("8 facetted plots");
+  } catch (const std::exception &e) {
+    std::fprintf(stderr, "%s\n", e.what());
+    return 1;
+  }
+  return 0;
+}
@@ -0,0 +1,42 @@
+// a loop that prints 100k lines, submit to done as a client sees it. every
+// print is an item evaluate() hands back, so this is mostly the per-item cost
+// of classifying and collecting output in process_r_code
+//
+// needs a running haRness. one warmup run, then runs timed runs
+//
+// usage: print_loop [address, default localhost:50051] [runs, default 5]
+//                   [lines, default 100000]
+
+#include "bench_client.h"
+
+#include <cstdio>
+#include <exception>
+#include <string>
+
+int main(int argc, char **argv) {
+  std::size_t runs = bench::size_arg(argc, argv, 2, 5);
+  std::size_t lines = bench::size_arg(argc, argv, 3, 100000);
+  const std::string code =
+      "for (i in 1:" + std::to_string(lines) + ") print(i)";
+
+  try {
+    auto stub = bench::connect(argc, argv, 1);
+    EvalOperation operation;
+    bench::run(*stub, code, "bench-print-loop", &operation);
+    if (operation.eval_result().status() != EVAL_SUCCESS) {
+      std::fprintf(stderr, "the loop didn't succeed, status %d\n",
+                   operation.eval_result().status());
+      return 1;
+    }
+
+    bench::LatencySamples samples;
+    for (std::size_t i = 0; i < runs; ++i) {
+      samples.add(bench::run(*stub, code, "bench-print-loop"));
+    }
+    samples.print(std::to_string(lines) + " printed lines");
+  } catch (const std::exception &e) {
+    std::fprintf(stderr, "%s\n", e.what());
+    return 1;
+  }
+  return 0;
+}
@@ -0,0 +1,209 @@
+// allocations on the way of one result from the worker to a polling client,
+// for a snippet with a few multi-MB SVG plots. stage by stage:
+//   ipc           write_response_frame on a socketpair, the front-end's
+//                 read_frame and deserialize_response
+//   result        ProcessRResponseQueue: take_result_payload, the EvalResult
+//                 built from it, putPlot, compress_eval_result
+//   store         updateEvalOperation
+//   poll by ref   getEvalOperation and the copy into the response
+//   poll inline   the same, decompressed and with the plots inlined like
+//                 GetEvalOperation does for clients without plots_by_reference
+//
+// counts operator new, so what zstd mallocs for itself isn't in there. an
+// allocation of at least a plot's size is most likely a copy of one
+//
+// usage: result_allocations [plots, default 4] [plot_mb, default 4]
+
+#include "bench_util.h"
+#include "operation_store.h"
+#include "payload_compression.h"
+#include "plot_store.h"
+#include "r_ipc.h"
+#include "r_result.h"
+
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+#include <random>
+#include <string>
+#include <sys/socket.h>
+#include <thread>
+#include <unistd.h>
+
+namespace {
+
+std::atomic<std::size_t> num_allocations = 0;
+std::atomic<std::size_t> allocated_bytes = 0;
+std::atomic<std::size_t> num_big_allocations = 0;
+// set to the plot size, anything this big counts as big
+std::size_t big_allocation = SIZE_MAX;
+
+void *counted_alloc(std::size_t size) {
+  num_allocations.fetch_add(1, std::memory_order_relaxed);
+  allocated_bytes.fetch_add(size, std::memory_order_relaxed);
+  if (size >= big_allocation) {
+    num_big_allocations.fetch_add(1, std::memory_order_relaxed);
+  }
+  if (void *p = std::malloc(size == 0 ? 1 : size)) {
+    return p;
+  }
+  throw std::bad_alloc();
+}
+
+} // namespace
+
+void *operator new(std::size_t size) { return counted_alloc(size); }
+void *operator new[](std::size_t size) { return counted_alloc(size); }
+void operator delete(void *p) noexcept { std::free(p); }
+void operator delete[](void *p) noexcept { std::free(p); }
+void operator delete(void *p, std::size_t) noexcept { std::free(p); }
+void operator delete[](void *p, std::size_t) noexcept { std::free(p); }
+
+namespace {
+
+// what a stage allocated, from construction to report()
+class Stage {
+public:
+  Stage()
+      : allocations_(num_allocations), bytes_(allocated_bytes),
+        big_(num_big_allocations) {}
+
+  void report(const char *label) const {
+    std::printf("%-14s allocations %8zu   %9.1f MB   >= plot size %3zu\n",
+                label, num_allocations - allocations_,
+                double(allocated_bytes - bytes_) / (1024 * 1024),
+                num_big_allocations - big_);
+  }
+
+private:
+  std::size_t allocations_;
+  std::size_t bytes_;
+  std::size_t big_;
+};
+
+// ggplot-ish svg, paths with random coordinates so that it compresses like
+// a real one and not like a run of the same bytes
+std::string make_svg(std::size_t bytes, std::mt19937 &rng) {
+  std::uniform_int_distribution<int> coordinate(0, 72000);
+  std::string svg = "<svg xmlns=\"http://www.w3.org/2000/svg\">\n";
+  while (svg.size() < bytes) {
+    svg += "<path d=\"M " + std::to_string(coordinate(rng) / 100.0) + " " +
+           std::to_string(coordinate(rng) / 100.0) + " L " +
+           std::to_string(coordinate(rng) / 100.0) + " " +
+           std::to_string(coordinate(rng) / 100.0) +
+           "\" style=\"stroke-width: 1.07; stroke: #595959;\"/>\n";
+  }
+  svg += "</svg>\n";
+  return svg;
+}
+
+} // namespace
+
+int main(int argc, char **argv) {
+  std::size_t num_plots = bench::size_arg(argc, argv, 1, 4);
+  std::size_t plot_bytes = bench::size_arg(argc, argv, 2, 4) * 1024 * 1024;
+
+  // the worker's response, built before anything is counted
+  std::mt19937 rng(42);
+  RWorker::RClientOutputPayload output;
+  for (int i = 0; i < 200; ++i) {
+    output.console_output.push_back("[1] line " + std::to_string(i));
+  }
+  for (std::size_t i = 0; i < num_plots; ++i) {
+    output.graphic_output.push_back(
+        {RWorker::PlotFormat::SVG, make_svg(plot_bytes, rng)});
+  }
+  RWorker::RResponse worker_response(
+      "bench-op", RWorker::ResponseStatus::SUCCESS, std::move(output));
+
+  PlotStore plot_store;
+  EvalOperationStore operation_store;
+  operation_store.createEvalOperation("bench-op");
+  PayloadCompressionOptions compression_options;
+
+  int fds[2];
+  if (socketpair(AF_UNIX, SOCK_STREAM, 0, fds) != 0) {
+    std::perror("socketpair");
+    return 1;
+  }
+
+  std::printf("%zu plots of %zu bytes, 200 lines\n", num_plots, plot_bytes);
+  big_allocation = plot_bytes;
+
+  std::unique_ptr<RWorker::RResponse> response;
+  {
+    Stage stage;
+    // a frame this big doesn't fit the socket buffer, it is read meanwhile
+    std::thread reader([&] {
+      RWorker::Frame frame;
+      if (RWorker::read_frame(fds[1], frame)) {
+        response = RWorker::deserialize_response(frame.payload);
+      }
+    });
+    RWorker::write_response_frame(fds[0], worker_response);
+    reader.join();
+    stage.report("ipc");
+  }
+  close(fds[0]);
+  close(fds[1]);
+  if (response == nullptr) {
+    std::fprintf(stderr, "no response read\n");
+    return 1;
+  }
+
+  // ProcessRResponseQueue's part for a client output payload
+  EvalResult eval_result;
+  {
+    Stage stage;
+    RWorker::ResultData eval_data = response->take_result_payload();
+    auto &client_output = std::get<RWorker::RClientOutputPayload>(eval_data);
+    eval_result.set_status(EVAL_SUCCESS);
+    eval_result.mutable_interpreter_lines()->Reserve(
+        client_output.console_output.size());
+    for (std::string &line : client_output.console_output) {
+      eval_result.add_interpreter_lines(std::move(line));
+    }
+    eval_result.mutable_plot_refs()->Reserve(
+        client_output.graphic_output.size());
+    for (RWorker::PlotOutput &plot : client_output.graphic_output) {
+      *eval_result.add_plot_refs() =
+          plot_store.putPlot(PLOT_FORMAT_SVG, std::move(plot.data));
+    }
+    compress_eval_result(eval_result, compression_options);
+    stage.report("result");
+  }
+
+  {
+    Stage stage;
+    operation_store.updateEvalOperation(
+        "bench-op", [&](EvalOperation &operation) {
+          *operation.mutable_eval_result() = std::move(eval_result);
+          operation.set_done(true);
+        });
+    stage.report("store");
+  }
+
+  {
+    Stage stage;
+    EvalOperationLookup lookup = operation_store.getEvalOperation("bench-op");
+    EvalOperation poll_response;
+    poll_response.CopyFrom(*lookup.operation);
+    stage.report("poll by ref");
+  }
+
+  {
+    Stage stage;
+    EvalOperationLookup lookup = operation_store.getEvalOperation("bench-op");
+    EvalOperation poll_response;
+    poll_response.CopyFrom(*lookup.operation);
+    EvalResult &result = *poll_response.mutable_eval_result();
+    decompress_eval_result(result);
+    for (const PlotRef &ref : result.plot_refs()) {
+      result.add_svg_plots(decoded_plot_data(*plot_store.getPlot(ref.id())));
+    }
+    result.clear_plot_refs();
+    stage.report("poll inline");
+  }
+  return 0;
+}
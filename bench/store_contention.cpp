@@ -0,0 +1,223 @@
+// GetEvalOperation polls against the response thread's updates, many reader
+// threads and one writer, the way the front-end drives the operation store.
+// two stores:
+//   global mutex  the old store: one mutex, the proto updated in place and
+//                 copied out while holding it
+//   sharded       EvalOperationStore, sharded with immutable snapshots. the
+//                 reader copies the snapshot after the lookup, like the
+//                 GetEvalOperation handler does
+//
+// the writer is the response thread: it creates an operation and then stores
+// its result, 50 lines and one svg of svg_bytes. readers poll one of the last
+// 1000 operations created. both stores keep at most 2000 operations, the
+// oldest go first
+//
+// usage: store_contention [readers, default 8] [seconds, default 2]
+//                         [svg_bytes, default 32768]
+
+#include "bench_util.h"
+#include "operation_store.h"
+#include "reval_service.pb.h"
+
+#include <absl/container/flat_hash_map.h>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <optional>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+
+// polled by the readers, the most recent ones
+constexpr std::size_t num_polled = 1000;
+constexpr std::size_t max_entries = 2000;
+// one in this many calls is timed, timing every one costs more than a lookup
+constexpr std::size_t sample_every = 16;
+
+std::string operation_name(std::size_t i) { return "op-" + std::to_string(i); }
+
+EvalResult make_result(std::size_t svg_bytes) {
+  EvalResult result;
+  result.set_status(EVAL_SUCCESS);
+  for (int i = 0; i < 50; ++i) {
+    result.add_interpreter_lines("[1] some console output, line " +
+                                 std::to_string(i));
+  }
+  result.add_svg_plots(std::string(svg_bytes, 'x'));
+  return result;
+}
+
+// the hot path of the store before sharding. it evicted in a background
+// thread under the same mutex, here the oldest goes right away instead
+class GlobalMutexStore {
+public:
+  void create(const std::string &name) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    operations_[name].set_name(name);
+    creation_order_.push_back(name);
+    if (creation_order_.size() > max_entries) {
+      operations_.erase(creation_order_.front());
+      creation_order_.pop_front();
+    }
+  }
+
+  std::optional<EvalOperation> get(const std::string &name) const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = operations_.find(name);
+    if (it == operations_.end()) {
+      return std::nullopt;
+    }
+    return it->second;
+  }
+
+  void update(const std::string &name,
+              const std::function<void(EvalOperation &)> &updater) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = operations_.find(name);
+    if (it != operations_.end()) {
+      updater(it->second);
+      // the old store kept its byte accounting current on every update
+      it->second.ByteSizeLong();
+    }
+  }
+
+private:
+  mutable std::mutex mutex_;
+  absl::flat_hash_map<std::string, EvalOperation> operations_;
+  std::deque<std::string> creation_order_;
+};
+
+struct RunResult {
+  bench::LatencySamples polls;
+  bench::LatencySamples updates;
+  std::size_t num_polls = 0;
+  std::size_t num_updates = 0;
+};
+
+// runs readers threads of poll and one writer thread of write for seconds,
+// after writing the first num_polled operations
+template <typename Poll, typename Write>
+RunResult run(std::size_t readers, std::chrono::seconds seconds, Poll poll,
+              Write write) {
+  std::atomic<bool> stop = false;
+  std::vector<RunResult> per_reader(readers);
+  RunResult result;
+
+  std::size_t next = 0;
+  for (; next < num_polled; ++next) {
+    write(operation_name(next));
+  }
+  // the readers only look at operations that have their result
+  std::atomic<std::size_t> published = next;
+
+  std::vector<std::thread> threads;
+  for (std::size_t r = 0; r < readers; ++r) {
+    threads.emplace_back([&, r] {
+      std::mt19937 rng(r);
+      std::uniform_int_distribution<std::size_t> pick(1, num_polled);
+      RunResult &mine = per_reader[r];
+      while (!stop.load(std::memory_order_relaxed)) {
+        std::string name = operation_name(published.load() - pick(rng));
+        if (mine.num_polls++ % sample_every == 0) {
+          auto start = std::chrono::steady_clock::now();
+          poll(name);
+          mine.polls.add(std::chrono::steady_clock::now() - start);
+        } else {
+          poll(name);
+        }
+      }
+    });
+  }
+  threads.emplace_back([&] {
+    while (!stop.load(std::memory_order_relaxed)) {
+      std::string name = operation_name(next++);
+      auto start = std::chrono::steady_clock::now();
+      write(name);
+      result.updates.add(std::chrono::steady_clock::now() - start);
+      published = next;
+      ++result.num_updates;
+    }
+  });
+
+  std::this_thread::sleep_for(seconds);
+  stop = true;
+  for (auto &thread : threads) {
+    thread.join();
+  }
+  for (auto &mine : per_reader) {
+    result.num_polls += mine.num_polls;
+    result.polls.merge(mine.polls);
+  }
+  return result;
+}
+
+void report(const char *label, RunResult &result,
+            std::chrono::seconds seconds) {
+  std::printf("%s\n", label);
+  std::printf("  polls/s %12.0f   results/s %10.0f\n",
+              double(result.num_polls) / seconds.count(),
+              double(result.num_updates) / seconds.count());
+  result.polls.print("  poll (1 in 16 timed)");
+  result.updates.print("  create + result");
+}
+
+} // namespace
+
+int main(int argc, char **argv) {
+  std::size_t readers = bench::size_arg(argc, argv, 1, 8);
+  std::chrono::seconds seconds(bench::size_arg(argc, argv, 2, 2));
+  std::size_t svg_bytes = bench::size_arg(argc, argv, 3, 32 * 1024);
+
+  const EvalResult result = make_result(svg_bytes);
+  auto set_result = [&](EvalOperation &operation) {
+    operation.set_done(true);
+    *operation.mutable_eval_result() = result;
+  };
+
+  std::printf("%zu readers, 1 writer, results of %zu bytes, %llds\n",
+              readers, result.ByteSizeLong(),
+              static_cast<long long>(seconds.count()));
+
+  {
+    GlobalMutexStore store;
+    RunResult run_result = run(
+        readers, seconds,
+        [&](const std::string &name) {
+          std::optional<EvalOperation> operation = store.get(name);
+          bench::do_not_optimize(operation);
+        },
+        [&](const std::string &name) {
+          store.create(name);
+          store.update(name, set_result);
+        });
+    report("global mutex", run_result, seconds);
+  }
+
+  {
+    EvalOperationStoreLimits limits;
+    limits.max_entries = max_entries;
+    EvalOperationStore store(limits);
+    RunResult run_result = run(
+        readers, seconds,
+        [&](const std::string &name) {
+          EvalOperationLookup lookup = store.getEvalOperation(name);
+          if (lookup.status == OperationLookupStatus::FOUND) {
+            EvalOperation response;
+            response.CopyFrom(*lookup.operation);
+            bench::do_not_optimize(response);
+          }
+        },
+        [&](const std::string &name) {
+          store.createEvalOperation(name);
+          store.updateEvalOperation(name, set_result);
+        });
+    report("sharded", run_result, seconds);
+  }
+  return 0;
+}
@@ -0,0 +1,75 @@
+// zstd levels on plot files, through zstd_compress/zstd_decompress like
+// the plot store and compress_eval_result use them. per level: the ratio over
+// all files, and compress/decompress time per file
+//
+// give it real plots, e.g. SVGs saved by svglite from the ggplots an agent
+// makes. each file is compressed runs times per level
+//
+// usage: zstd_levels runs file.svg...
+
+#include "bench_util.h"
+#include "payload_compression.h"
+
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace {
+
+constexpr int levels[] = {1, 3, 6, 9, 12, 15, 19};
+
+} // namespace
+
+int main(int argc, char **argv) {
+  if (argc < 3) {
+    std::fprintf(stderr, "usage: %s runs file.svg...\n", argv[0]);
+    return 1;
+  }
+  std::size_t runs = bench::size_arg(argc, argv, 1, 5);
+
+  std::vector<std::string> files;
+  std::size_t total_bytes = 0;
+  for (int i = 2; i < argc; ++i) {
+    std::ifstream in(argv[i], std::ios::binary);
+    if (!in) {
+      std::fprintf(stderr, "can't read %s\n", argv[i]);
+      return 1;
+    }
+    std::ostringstream data;
+    data << in.rdbuf();
+    files.push_back(data.str());
+    total_bytes += files.back().size();
+  }
+  std::printf("%zu files, %.1f KB on average, %zu runs\n", files.size(),
+              double(total_bytes) / files.size() / 1024, runs);
+
+  for (int level : levels) {
+    bench::LatencySamples compress;
+    bench::LatencySamples decompress;
+    std::size_t compressed_bytes = 0;
+    for (std::size_t run = 0; run < runs; ++run) {
+      for (const std::string &file : files) {
+        auto start = std::chrono::steady_clock::now();
+        std::string compressed = zstd_compress(file, level);
+        auto compressed_at = std::chrono::steady_clock::now();
+        std::string decompressed = zstd_decompress(compressed);
+        auto end = std::chrono::steady_clock::now();
+        bench::do_not_optimize(decompressed);
+
+        compress.add(compressed_at - start);
+        decompress.add(end - compressed_at);
+        if (run == 0) {
+          compressed_bytes += compressed.size();
+        }
+      }
+    }
+    std::printf("level %2d  ratio %5.2f\n", level,
+                double(total_bytes) / compressed_bytes);
+    compress.print("  compress");
+    decompress.print("  decompress");
+  }
+  return 0;
+}
@@ -1,18 +1,24 @@
 #!/bin/bash
 
-if [ "$#" -ne 1 ]; then
-  echo "Usage: $0 <proto_filename>"
+# CMake passes everything but the proto file, the defaults are for running it
+# by hand after a build in build/
+if [ "$#" -lt 1 ] || [ "$#" -gt 5 ]; then
+  echo "Usage: $0 <proto_filename> [out_dir] [protoc] [grpc_cpp_plugin] [protobuf_include_dir]"
   exit 1
 fi
 
 PROTO_FILE=$1
+OUT_DIR=${2:-src/cpp_generated}
+PROTOC=${3:-build/_deps/grpc-build/third_party/protobuf/protoc}
+GRPC_CPP_PLUGIN=${4:-build/_deps/grpc-build/grpc_cpp_plugin}
+PROTOBUF_INCLUDE_DIR=${5:-build/_deps/grpc-src/third_party/protobuf/src}
 
-build/_deps/grpc-build/third_party/protobuf/protoc \
+mkdir -p "$OUT_DIR"
+
+"$PROTOC" \
   --proto_path=src/proto/ \
-  --proto_path=build/_deps/grpc-src/src/proto/ \
-  --proto_path=build/_deps/grpc-src/third_party/protobuf/src/ \
-  --cpp_out=src/cpp_generated/ \
-  --grpc_out=src/cpp_generated/ \
-  --plugin=protoc-gen-grpc=build/_deps/grpc-build/grpc_cpp_plugin \
+  --proto_path="$PROTOBUF_INCLUDE_DIR" \
+  --cpp_out="$OUT_DIR" \
+  --grpc_out="$OUT_DIR" \
+  --plugin=protoc-gen-grpc="$GRPC_CPP_PLUGIN" \
   src/proto/$PROTO_FILE
-
@@ -0,0 +1,420 @@
+#include "arrow_ipc.h"
+
+#include <algorithm>
+#include <cstring>
+#include <memory>
+#include <stdexcept>
+
+namespace {
+
+// field ids and enum values from Arrow's format/Message.fbs and Schema.fbs
+constexpr int16_t metadata_version_v5 = 4;
+constexpr uint8_t message_header_schema = 1;
+constexpr uint8_t message_header_dictionary_batch = 2;
+constexpr uint8_t message_header_record_batch = 3;
+
+constexpr uint8_t type_int = 2;
+constexpr uint8_t type_floating_point = 3;
+constexpr uint8_t type_utf8 = 5;
+constexpr uint8_t type_bool = 6;
+constexpr uint8_t type_date = 8;
+
+constexpr int16_t precision_double = 2;
+constexpr int16_t date_unit_day = 0;
+
+// buffers in the body start at multiples of this
+constexpr std::size_t body_alignment = 8;
+constexpr char zero_padding[body_alignment] = {};
+
+// a flatbuffers object tree, serialized front to back so that every offset
+// points forward like the format wants
+struct FbObject;
+using FbRef = std::shared_ptr<FbObject>;
+
+struct FbField {
+  int id;
+  // 1, 2, 4 or 8 byte scalar, or a reference if child is set
+  int size = 0;
+  int64_t scalar = 0;
+  FbRef child;
+};
+
+struct FbObject {
+  enum class Kind { TABLE, STRING, STRUCT_VECTOR, TABLE_VECTOR };
+  explicit FbObject(Kind object_kind) : kind(object_kind) {}
+
+  Kind kind;
+  std::vector<FbField> fields;
+  // STRING bytes, or the raw structs of a STRUCT_VECTOR
+  std::string bytes;
+  std::size_t num_structs = 0;
+  std::vector<FbRef> tables;
+};
+
+class FbTableBuilder {
+public:
+  FbTableBuilder &add_scalar(int id, int size, int64_t value) {
+    object_->fields.push_back({id, size, value, nullptr});
+    return *this;
+  }
+  FbTableBuilder &add_bool(int id, bool value) {
+    return add_scalar(id, 1, value ? 1 : 0);
+  }
+  FbTableBuilder &add_ref(int id, FbRef child) {
+    object_->fields.push_back({id, 4, 0, std::move(child)});
+    return *this;
+  }
+  FbRef build() { return std::move(object_); }
+
+private:
+  FbRef object_ = std::make_shared<FbObject>(FbObject::Kind::TABLE);
+};
+
+FbRef fb_string(std::string_view value) {
+  auto object = std::make_shared<FbObject>(FbObject::Kind::STRING);
+  object->bytes = std::string(value);
+  return object;
+}
+
+FbRef fb_table_vector(std::vector<FbRef> tables) {
+  auto object = std::make_shared<FbObject>(FbObject::Kind::TABLE_VECTOR);
+  object->tables = std::move(tables);
+  return object;
+}
+
+// FieldNode and Buffer are both two int64s
+FbRef fb_int64_pair_vector(
+    const std::vector<std::pair<int64_t, int64_t>> &pairs) {
+  auto object = std::make_shared<FbObject>(FbObject::Kind::STRUCT_VECTOR);
+  object->num_structs = pairs.size();
+  for (const auto &[first, second] : pairs) {
+    object->bytes.append(reinterpret_cast<const char *>(&first), sizeof(first));
+    object->bytes.append(reinterpret_cast<const char *>(&second),
+                         sizeof(second));
+  }
+  return object;
+}
+
+class FbSerializer {
+public:
+  std::string finish(const FbRef &root) {
+    std::size_t root_offset = reserve(4, 4);
+    patch(root_offset, write(*root));
+    pad_to(8, 0);
+    return std::move(out_);
+  }
+
+private:
+  // pads so that out_.size() % alignment == remainder
+  void pad_to(std::size_t alignment, std::size_t remainder) {
+    while (out_.size() % alignment != remainder) {
+      out_.push_back('\0');
+    }
+  }
+
+  std::size_t reserve(std::size_t size, std::size_t alignment) {
+    pad_to(alignment, 0);
+    std::size_t position = out_.size();
+    out_.append(size, '\0');
+    return position;
+  }
+
+  template <typename T> void put_at(std::size_t position, T value) {
+    std::memcpy(out_.data() + position, &value, sizeof(T));
+  }
+
+  // the uoffset at position points to target
+  void patch(std::size_t position, std::size_t target) {
+    put_at<uint32_t>(position, static_cast<uint32_t>(target - position));
+  }
+
+  std::size_t write(const FbObject &object) {
+    switch (object.kind) {
+    case FbObject::Kind::TABLE:
+      return write_table(object);
+    case FbObject::Kind::STRING: {
+      std::size_t position = reserve(4, 4);
+      put_at<uint32_t>(position, static_cast<uint32_t>(object.bytes.size()));
+      out_.append(object.bytes);
+      out_.push_back('\0');
+      return position;
+    }
+    case FbObject::Kind::STRUCT_VECTOR: {
+      // the structs have int64s, the first one goes 8 aligned
+      pad_to(8, 4);
+      std::size_t position = out_.size();
+      out_.append(4, '\0');
+      put_at<uint32_t>(position, static_cast<uint32_t>(object.num_structs));
+      out_.append(object.bytes);
+      return position;
+    }
+    case FbObject::Kind::TABLE_VECTOR: {
+      std::size_t position = reserve(4 + 4 * object.tables.size(), 4);
+      put_at<uint32_t>(position, static_cast<uint32_t>(object.tables.size()));
+      for (std::size_t i = 0; i < object.tables.size(); ++i) {
+        patch(position + 4 + 4 * i, write(*object.tables[i]));
+      }
+      return position;
+    }
+    }
+    throw std::logic_error("unknown flatbuffers object");
+  }
+
+  std::size_t write_table(const FbObject &table) {
+    // inline layout: the soffset to the vtable, then the fields biggest
+    // first so that each one is naturally aligned
+    std::vector<const FbField *> fields;
+    for (const FbField &field : table.fields) {
+      fields.push_back(&field);
+    }
+    std::stable_sort(fields.begin(), fields.end(),
+                     [](const FbField *a, const FbField *b) {
+                       return a->size > b->size;
+                     });
+
+    std::vector<uint16_t> field_offsets(table.fields.size());
+    std::size_t table_size = 4;
+    int max_id = -1;
+    for (const FbField *field : fields) {
+      table_size = (table_size + field->size - 1) / field->size * field->size;
+      field_offsets[field - table.fields.data()] =
+          static_cast<uint16_t>(table_size);
+      table_size += field->size;
+      max_id = std::max(max_id, field->id);
+    }
+    table_size = (table_size + 3) / 4 * 4;
+
+    // vtable: its size, the table's size, a field offset per id
+    std::size_t vtable_size = 4 + 2 * static_cast<std::size_t>(max_id + 1);
+    std::size_t vtable_position = reserve(vtable_size, 2);
+    put_at<uint16_t>(vtable_position, static_cast<uint16_t>(vtable_size));
+    put_at<uint16_t>(vtable_position + 2, static_cast<uint16_t>(table_size));
+    for (std::size_t i = 0; i < table.fields.size(); ++i) {
+      put_at<uint16_t>(vtable_position + 4 + 2 * table.fields[i].id,
+                       field_offsets[i]);
+    }
+
+    std::size_t table_position = reserve(table_size, 8);
+    put_at<int32_t>(table_position,
+                    static_cast<int32_t>(table_position - vtable_position));
+    for (std::size_t i = 0; i < table.fields.size(); ++i) {
+      const FbField &field = table.fields[i];
+      std::size_t position = table_position + field_offsets[i];
+      switch (field.child ? 0 : field.size) {
+      case 0:
+        break;
+      case 1:
+        put_at<uint8_t>(position, static_cast<uint8_t>(field.scalar));
+        break;
+      case 2:
+        put_at<int16_t>(position, static_cast<int16_t>(field.scalar));
+        break;
+      case 4:
+        put_at<int32_t>(position, static_cast<int32_t>(field.scalar));
+        break;
+      case 8:
+        put_at<int64_t>(position, field.scalar);
+        break;
+      }
+    }
+
+    // children after the table, their offsets point forward
+    for (std::size_t i = 0; i < table.fields.size(); ++i) {
+      if (table.fields[i].child) {
+        patch(table_position + field_offsets[i], write(*table.fields[i].child));
+      }
+    }
+    return table_position;
+  }
+
+  std::string out_;
+};
+
+FbRef int_type(int bit_width, bool is_signed) {
+  return FbTableBuilder()
+      .add_scalar(0, 4, bit_width)
+      .add_bool(1, is_signed)
+      .build();
+}
+
+// type_type and type of a field's value type
+std::pair<uint8_t, FbRef> value_type(ArrowColumnType type) {
+  switch (type) {
+  case ArrowColumnType::INT32:
+    return {type_int, int_type(32, true)};
+  case ArrowColumnType::FLOAT64:
+    return {type_floating_point,
+            FbTableBuilder().add_scalar(0, 2, precision_double).build()};
+  case ArrowColumnType::BOOL:
+    return {type_bool, FbTableBuilder().build()};
+  case ArrowColumnType::DATE32:
+    return {type_date, FbTableBuilder().add_scalar(0, 2, date_unit_day).build()};
+  case ArrowColumnType::UTF8:
+  case ArrowColumnType::DICTIONARY_UTF8:
+    return {type_utf8, FbTableBuilder().build()};
+  }
+  throw std::logic_error("unknown Arrow column type");
+}
+
+ArrowIpcMessage encapsulate(uint8_t header_type, FbRef header,
+                            std::vector<std::string_view> body,
+                            int64_t body_length) {
+  FbRef message = FbTableBuilder()
+                      .add_scalar(0, 2, metadata_version_v5)
+                      .add_scalar(1, 1, header_type)
+                      .add_ref(2, std::move(header))
+                      .add_scalar(3, 8, body_length)
+                      .build();
+  std::string flatbuffer = FbSerializer().finish(message);
+
+  // continuation marker and metadata length, the flatbuffer is already
+  // padded to 8 so the body starts aligned
+  ArrowIpcMessage encoded;
+  uint32_t continuation = 0xFFFFFFFF;
+  int32_t metadata_length = static_cast<int32_t>(flatbuffer.size());
+  encoded.metadata.append(reinterpret_cast<const char *>(&continuation), 4);
+  encoded.metadata.append(reinterpret_cast<const char *>(&metadata_length), 4);
+  encoded.metadata.append(flatbuffer);
+  encoded.body = std::move(body);
+  return encoded;
+}
+
+// collects a batch's buffers and their positions in the body
+class BodyBuilder {
+public:
+  void add_buffer(std::string_view buffer) {
+    buffers_.emplace_back(static_cast<int64_t>(length_),
+                          static_cast<int64_t>(buffer.size()));
+    if (!buffer.empty()) {
+      body_.push_back(buffer);
+    }
+    length_ += buffer.size();
+    std::size_t padding = (body_alignment - length_ % body_alignment) %
+                          body_alignment;
+    if (padding > 0) {
+      body_.emplace_back(zero_padding, padding);
+      length_ += padding;
+    }
+  }
+
+  void add_column(const ArrowColumn &column, ArrowColumnType type) {
+    nodes_.emplace_back(column.length, column.null_count);
+    add_buffer(column.null_count > 0 ? column.validity : std::string_view());
+    add_buffer(column.values);
+    if (type == ArrowColumnType::UTF8) {
+      add_buffer(column.data);
+    }
+  }
+
+  // the RecordBatch table for what was added
+  FbRef record_batch(int64_t rows) const {
+    return FbTableBuilder()
+        .add_scalar(0, 8, rows)
+        .add_ref(1, fb_int64_pair_vector(nodes_))
+        .add_ref(2, fb_int64_pair_vector(buffers_))
+        .build();
+  }
+
+  std::vector<std::string_view> take_body() { return std::move(body_); }
+  int64_t length() const { return static_cast<int64_t>(length_); }
+
+private:
+  std::vector<std::pair<int64_t, int64_t>> nodes_;
+  std::vector<std::pair<int64_t, int64_t>> buffers_;
+  std::vector<std::string_view> body_;
+  std::size_t length_ = 0;
+};
+
+} // namespace
+
+std::size_t ArrowIpcMessage::size() const {
+  std::size_t size = metadata.size();
+  for (std::string_view piece : body) {
+    size += piece.size();
+  }
+  return size;
+}
+
+std::string ArrowIpcMessage::to_string() const {
+  std::string out;
+  out.reserve(size());
+  out.append(metadata);
+  for (std::string_view piece : body) {
+    out.append(piece);
+  }
+  return out;
+}
+
+ArrowIpcMessage
+encode_arrow_schema(const std::vector<ArrowField> &fields,
+                    const std::vector<ArrowKeyValue> &custom_metadata) {
+  std::vector<FbRef> field_tables;
+  for (const ArrowField &field : fields) {
+    auto [type_type, type] = value_type(field.type);
+    FbTableBuilder builder;
+    builder.add_ref(0, fb_string(field.name))
+        .add_bool(1, true)
+        .add_scalar(2, 1, type_type)
+        .add_ref(3, std::move(type))
+        // readers want the children vector even when it is empty
+        .add_ref(5, fb_table_vector({}));
+    if (field.type == ArrowColumnType::DICTIONARY_UTF8) {
+      builder.add_ref(4, FbTableBuilder()
+                             .add_scalar(0, 8, field.dictionary_id)
+                             .add_ref(1, int_type(32, true))
+                             .add_bool(2, field.dictionary_ordered)
+                             .build());
+    }
+    field_tables.push_back(builder.build());
+  }
+
+  std::vector<FbRef> key_values;
+  for (const auto &[key, value] : custom_metadata) {
+    key_values.push_back(FbTableBuilder()
+                             .add_ref(0, fb_string(key))
+                             .add_ref(1, fb_string(value))
+                             .build());
+  }
+
+  FbRef schema = FbTableBuilder()
+                     .add_ref(1, fb_table_vector(std::move(field_tables)))
+                     .add_ref(2, fb_table_vector(std::move(key_values)))
+                     .build();
+  return encapsulate(message_header_schema, std::move(schema), {}, 0);
+}
+
+ArrowIpcMessage encode_arrow_record_batch(
+    int64_t rows, const std::vector<ArrowField> &fields,
+    const std::vector<ArrowColumn> &columns) {
+  if (fields.size() != columns.size()) {
+    throw std::invalid_argument("record batch needs a column per field");
+  }
+  BodyBuilder body;
+  for (std::size_t i = 0; i < columns.size(); ++i) {
+    body.add_column(columns[i], fields[i].type);
+  }
+  int64_t body_length = body.length();
+  FbRef batch = body.record_batch(rows);
+  return encapsulate(message_header_record_batch, std::move(batch),
+                     body.take_body(), body_length);
+}
+
+ArrowIpcMessage encode_arrow_dictionary_batch(int64_t dictionary_id,
+                                              const ArrowColumn &values) {
+  BodyBuilder body;
+  body.add_column(values, ArrowColumnType::UTF8);
+  int64_t body_length = body.length();
+  FbRef dictionary_batch = FbTableBuilder()
+                               .add_scalar(0, 8, dictionary_id)
+                               .add_ref(1, body.record_batch(values.length))
+                               .build();
+  return encapsulate(message_header_dictionary_batch,
+                     std::move(dictionary_batch), body.take_body(),
+                     body_length);
+}
+
+std::string_view arrow_ipc_end_of_stream() {
+  static constexpr char end_of_stream[8] = {'\xFF', '\xFF', '\xFF', '\xFF',
+                                            0,      0,      0,      0};
+  return std::string_view(end_of_stream, sizeof(end_of_stream));
+}
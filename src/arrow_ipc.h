@@ -0,0 +1,82 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+// just enough of the Arrow IPC streaming format to send data frames
+//
+// a stream is a schema message, one dictionary batch per dictionary encoded
+// column, record batches, and the end-of-stream marker, each message one
+// after the other. any Arrow reader (pyarrow.ipc.open_stream,
+// arrow::read_ipc_stream, ...) takes the concatenation.
+//
+// the flatbuffers metadata is built by hand here rather than pulling Arrow
+// C++ (or flatbuffers) into the build, only the handful of types below are
+// ever written. the column buffers are not copied, a message is its metadata
+// plus views of the buffers, written out with a gather write
+
+enum class ArrowColumnType {
+  INT32,
+  FLOAT64,
+  BOOL,
+  UTF8,
+  // days since the epoch, int32
+  DATE32,
+  // int32 indices into a UTF8 dictionary, sent in its own dictionary batch
+  DICTIONARY_UTF8,
+};
+
+struct ArrowField {
+  std::string name;
+  ArrowColumnType type = ArrowColumnType::FLOAT64;
+  // DICTIONARY_UTF8 only
+  int64_t dictionary_id = 0;
+  bool dictionary_ordered = false;
+};
+
+// one column of a batch, the buffers are only referenced and have to outlive
+// the encoded message
+struct ArrowColumn {
+  int64_t length = 0;
+  int64_t null_count = 0;
+  // LSB first validity bitmap, empty if null_count is 0
+  std::string_view validity;
+  // the values, the indices for DICTIONARY_UTF8, the int32 offsets for UTF8
+  std::string_view values;
+  // UTF8 only, the string bytes the offsets point into
+  std::string_view data;
+};
+
+// an encapsulated message, the metadata followed by the body pieces (buffers
+// and the padding between them)
+struct ArrowIpcMessage {
+  std::string metadata;
+  std::vector<std::string_view> body;
+
+  std::size_t size() const;
+  // copies the message together
+  std::string to_string() const;
+};
+
+using ArrowKeyValue = std::pair<std::string, std::string>;
+
+ArrowIpcMessage
+encode_arrow_schema(const std::vector<ArrowField> &fields,
+                    const std::vector<ArrowKeyValue> &custom_metadata = {});
+// columns in the order of the schema's fields, all of length rows
+ArrowIpcMessage encode_arrow_record_batch(
+    int64_t rows, const std::vector<ArrowField> &fields,
+    const std::vector<ArrowColumn> &columns);
+// the UTF8 values of a DICTIONARY_UTF8 field's dictionary
+ArrowIpcMessage encode_arrow_dictionary_batch(int64_t dictionary_id,
+                                              const ArrowColumn &values);
+
+std::string_view arrow_ipc_end_of_stream();
+
+// bytes of a validity bitmap for length values
+inline std::size_t arrow_bitmap_bytes(int64_t length) {
+  return static_cast<std::size_t>((length + 7) / 8);
+}
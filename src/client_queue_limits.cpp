@@ -0,0 +1,52 @@
+#include "client_queue_limits.h"
+
+#include <algorithm>
+#include <utility>
+
+ClientQueueLimits::ClientQueueLimits(ClientQueueLimitsConfig config)
+    : config_(std::move(config)) {}
+
+std::size_t ClientQueueLimits::maxDepth(const std::string &client_id) const {
+  auto it = config_.max_depth_by_client.find(client_id);
+  return it != config_.max_depth_by_client.end() ? it->second
+                                                 : config_.max_depth;
+}
+
+bool ClientQueueLimits::admit(const std::string &client_id,
+                              const std::string &task_uuid,
+                              std::size_t cost) {
+  std::size_t max_depth = maxDepth(client_id);
+
+  std::lock_guard<std::mutex> lock(mutex_);
+  std::size_t &depth = depth_[client_id];
+  if (max_depth != 0 && depth > 0 && depth + cost > max_depth) {
+    ++num_rejected_;
+    return false;
+  }
+  depth += cost;
+  task_clients_.emplace(task_uuid, std::make_pair(client_id, cost));
+  return true;
+}
+
+void ClientQueueLimits::release(const std::string &task_uuid) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  auto task_it = task_clients_.find(task_uuid);
+  if (task_it == task_clients_.end()) {
+    return;
+  }
+
+  const auto &[client_id, cost] = task_it->second;
+  auto depth_it = depth_.find(client_id);
+  if (depth_it != depth_.end()) {
+    depth_it->second -= std::min(depth_it->second, cost);
+    if (depth_it->second == 0) {
+      depth_.erase(depth_it);
+    }
+  }
+  task_clients_.erase(task_it);
+}
+
+uint64_t ClientQueueLimits::numRejected() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return num_rejected_;
+}
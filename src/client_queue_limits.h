@@ -0,0 +1,62 @@
+#pragma once
+
+#include "absl/base/thread_annotations.h"
+#include "absl/container/flat_hash_map.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <utility>
+
+// caps how many tasks one client can have queued or running at a time
+//
+// the workers take turns between clients (RTaskScheduler), so a client with
+// a deep backlog doesn't starve the others there, but every queued task still
+// costs its worker memory and the client's own snippets their place in line.
+// past its limit a client's submissions are turned away with
+// RESOURCE_EXHAUSTED instead of being queued
+//
+// a task takes as many slots as it costs (RTask::get_cost(), a batch one per
+// snippet) when it is admitted and gives them back when its response comes
+// through the response queue, which every submitted task produces exactly
+// once. a batch bigger than the limit is only admitted while the client has
+// nothing else queued
+
+struct ClientQueueLimitsConfig {
+  // tasks per client, 0 for no limit
+  std::size_t max_depth = 256;
+  // per-client overrides of max_depth, by client id
+  absl::flat_hash_map<std::string, std::size_t> max_depth_by_client;
+};
+
+class ClientQueueLimits {
+public:
+  explicit ClientQueueLimits(ClientQueueLimitsConfig config = {});
+
+  ClientQueueLimits(const ClientQueueLimits &) = delete;
+  ClientQueueLimits &operator=(const ClientQueueLimits &) = delete;
+
+  // takes cost slots of client_id's queue for the task, false if they
+  // don't fit
+  bool admit(const std::string &client_id, const std::string &task_uuid,
+             std::size_t cost = 1);
+  // gives the task's slots back, nothing if it never had any
+  void release(const std::string &task_uuid);
+
+  // cumulative since startup, submissions turned away
+  uint64_t numRejected() const;
+
+private:
+  std::size_t maxDepth(const std::string &client_id) const;
+
+  const ClientQueueLimitsConfig config_;
+
+  mutable std::mutex mutex_;
+  // tasks queued or running, by client. clients without any are dropped
+  absl::flat_hash_map<std::string, std::size_t> depth_ ABSL_GUARDED_BY(mutex_);
+  // task -> client and cost, for release()
+  absl::flat_hash_map<std::string, std::pair<std::string, std::size_t>>
+      task_clients_ ABSL_GUARDED_BY(mutex_);
+  uint64_t num_rejected_ ABSL_GUARDED_BY(mutex_) = 0;
+};
@@ -1,17 +1,89 @@
 // local project
+#include "blockingconcurrentqueue.h"
+#include "client_queue_limits.h"
 #include "concurrentqueue.h"
 #include "grpcpp/security/server_credentials.h"
 #include "grpcpp/server_builder.h"
 #include "operation_store.h"
+#include "payload_compression.h"
+#include "plot_store.h"
 #include "r_eval_service_impl.h"
 #include "r_result.h"
 #include "r_task.h"
-#include "r_worker.h"
+#include "r_worker_pool.h"
 #include <absl/log/globals.h>
 #include <absl/log/initialize.h>
 #include <absl/log/log.h>
+#include <charconv>
+#include <chrono>
+#include <cstdlib>
+#include <exception>
 #include <grpcpp/grpcpp.h>
 #include <memory>
+#include <string>
+#include <string_view>
+#include <utility>
+
+// R worker processes started up front (HARNESS_R_WORKERS) and the most the
+// pool grows to as new sessions come in (HARNESS_R_MAX_WORKERS)
+constexpr std::size_t default_r_workers = 2;
+constexpr std::size_t default_max_r_workers = 8;
+// plot render helper processes per R worker (HARNESS_RENDER_HELPERS), 0 to
+// render plots on the worker itself
+constexpr std::size_t default_render_helpers = 2;
+// how long a session may go without a task before it is unpinned from its
+// worker (HARNESS_SESSION_IDLE_SECONDS), 0 to keep it pinned
+constexpr std::size_t default_session_idle_seconds = 3600;
+// time limit of evaluations whose request doesn't set one
+// (HARNESS_EVAL_TIMEOUT_SECONDS), 0 for none
+constexpr std::size_t default_eval_timeout_seconds = 300;
+
+static std::size_t size_from_env(const char *name, std::size_t fallback,
+                                 bool allow_zero = false) {
+  const char *env_value = std::getenv(name);
+  if (env_value == nullptr) {
+    return fallback;
+  }
+
+  try {
+    int value = std::stoi(env_value);
+    if (value > 0 || (allow_zero && value == 0)) {
+      return static_cast<std::size_t>(value);
+    }
+  } catch (const std::exception &) {
+  }
+
+  LOG(WARNING) << "Ignoring invalid " << name << "=" << env_value;
+  return fallback;
+}
+
+// per-client queue depths, "client=depth,client=depth"
+static void client_depths_from_env(const char *name,
+                                   ClientQueueLimitsConfig &config) {
+  const char *env_value = std::getenv(name);
+  if (env_value == nullptr) {
+    return;
+  }
+
+  std::string_view rest(env_value);
+  while (!rest.empty()) {
+    std::size_t comma = rest.find(',');
+    std::string_view entry = rest.substr(0, comma);
+    rest = comma == std::string_view::npos ? std::string_view()
+                                           : rest.substr(comma + 1);
+
+    std::size_t equals = entry.rfind('=');
+    std::size_t depth = 0;
+    if (equals == std::string_view::npos || equals == 0 ||
+        std::from_chars(entry.data() + equals + 1,
+                        entry.data() + entry.size(), depth)
+                .ptr != entry.data() + entry.size()) {
+      LOG(WARNING) << "Ignoring invalid " << name << " entry " << entry;
+      continue;
+    }
+    config.max_depth_by_client[std::string(entry.substr(0, equals))] = depth;
+  }
+}
 
 int main() {
   // namespace for ConcurrentQueue
@@ -23,22 +95,71 @@ int main() {
 
   LOG(INFO) << "haRness: main program starting up";
 
-  // stop source + token for the rworker thread
-  std::stop_source rworker_ssource;
-  std::stop_token rworker_stoken = rworker_ssource.get_token();
+  // global queue rworkers -> network
+  // the response queue is blocking so the response thread sleeps until a
+  // response arrives. declared before the pool, whose reader threads push
+  // into it until the pool is destroyed
+  BlockingConcurrentQueue<std::unique_ptr<RResponse>> responseQueue;
+
+  // fork the R zygote and first workers before anything (gRPC, the response
+  // thread) starts threads in this process
+  RWorkerPool rWorkerPool(
+      size_from_env("HARNESS_R_WORKERS", default_r_workers),
+      size_from_env("HARNESS_R_MAX_WORKERS", default_max_r_workers),
+      size_from_env("HARNESS_RENDER_HELPERS", default_render_helpers, true),
+      std::chrono::seconds(size_from_env("HARNESS_SESSION_IDLE_SECONDS",
+                                         default_session_idle_seconds, true)));
+  // output of finished evaluations is stored zstd compressed
+  PayloadCompressionOptions compressionOptions;
+  compressionOptions.zstd_level = static_cast<int>(size_from_env(
+      "HARNESS_ZSTD_LEVEL", compressionOptions.zstd_level, true));
+  compressionOptions.min_bytes =
+      size_from_env("HARNESS_COMPRESS_MIN_BYTES", compressionOptions.min_bytes);
+
+  // plots of stored results, each stored once however many results have it.
+  // declared before the operation store, whose evictions release into it
+  PlotStore plotStore(compressionOptions.zstd_level);
 
-  // global queues network <-> rworker
-  ConcurrentQueue<std::unique_ptr<RTask>> taskQueue;
-  ConcurrentQueue<std::unique_ptr<RResponse>> responseQueue;
-  // store for grpc to keep track of operations
-  EvalOperationStore operationStore;
+  // store for grpc to keep track of operations, finished operations are
+  // evicted by age, count and total size
+  EvalOperationStoreLimits storeLimits;
+  storeLimits.max_age = std::chrono::seconds(size_from_env(
+      "HARNESS_STORE_MAX_AGE_SECONDS", storeLimits.max_age.count()));
+  storeLimits.max_entries =
+      size_from_env("HARNESS_STORE_MAX_ENTRIES", storeLimits.max_entries);
+  storeLimits.max_total_bytes =
+      size_from_env("HARNESS_STORE_MAX_MB",
+                    storeLimits.max_total_bytes / (1024 * 1024)) *
+      1024 * 1024;
+  EvalOperationStore operationStore(
+      storeLimits, [&plotStore](const EvalOperation &evicted_operation) {
+        plotStore.releasePlots(evicted_operation.eval_result());
+      });
 
-  // create worker thread before creating gRPC server
-  std::thread rWorkerThread(RWorker::r_worker_thread, rworker_stoken,
-                            std::ref(taskQueue), std::ref(responseQueue));
+  rWorkerPool.start(responseQueue);
 
-  REvalServiceImpl rEvalService(std::ref(operationStore), std::ref(taskQueue),
-                                std::ref(responseQueue));
+  std::chrono::seconds defaultEvalTimeout(size_from_env(
+      "HARNESS_EVAL_TIMEOUT_SECONDS", default_eval_timeout_seconds, true));
+
+  // console output kept per evaluation, requests can only ask for less
+  OutputLimits outputLimits;
+  outputLimits.max_lines =
+      size_from_env("HARNESS_MAX_OUTPUT_LINES", outputLimits.max_lines);
+  outputLimits.max_bytes =
+      size_from_env("HARNESS_MAX_OUTPUT_BYTES", outputLimits.max_bytes);
+
+  // tasks one client may have queued before it is turned away, 0 for no
+  // limit. clients are told apart by their x-harness-client-id metadata
+  ClientQueueLimitsConfig clientQueueLimits;
+  clientQueueLimits.max_depth = size_from_env(
+      "HARNESS_CLIENT_QUEUE_DEPTH", clientQueueLimits.max_depth, true);
+  client_depths_from_env("HARNESS_CLIENT_QUEUE_DEPTHS", clientQueueLimits);
+
+  REvalServiceImpl rEvalService(std::ref(operationStore),
+                                std::ref(rWorkerPool), std::ref(plotStore),
+                                std::ref(responseQueue), compressionOptions,
+                                defaultEvalTimeout, outputLimits,
+                                std::move(clientQueueLimits));
 
   std::string server_address("0.0.0.0:50051");
 
@@ -59,10 +180,8 @@ int main() {
 
   server->Wait();
 
-  // will block
-  if (rWorkerThread.joinable()) {
-    rWorkerThread.join();
-  }
+  // RWorkerPool's destructor closes the worker and zygote sockets, which
+  // makes those processes exit
 
   return 0;
 }
@@ -1,42 +1,267 @@
 #include "operation_store.h"
 
-EvalOperation EvalOperationStore::createEvalOperation(const std::string& name_uuid) {
-  // ensure locked
-  std::lock_guard<std::mutex> lock(store_mutex_);
+#include <absl/log/log.h>
+#include <functional>
+#include <iterator>
+#include <utility>
+#include <vector>
 
-  EvalOperationData new_data;
-  new_data.operation_proto.set_name(name_uuid);
-  new_data.operation_proto.set_done(false);
+namespace {
+
+std::size_t divide_round_up(std::size_t value, std::size_t divisor) {
+  return (value + divisor - 1) / divisor;
+}
+
+} // namespace
+
+EvalOperationStore::EvalOperationStore(EvalOperationStoreLimits limits,
+                                       EvalOperationEvictionCallback on_evicted)
+    : limits_(limits), on_evicted_(std::move(on_evicted)),
+      shard_max_entries_(divide_round_up(limits.max_entries, num_shards)),
+      shard_max_bytes_(divide_round_up(limits.max_total_bytes, num_shards)),
+      shard_max_tombstones_(
+          divide_round_up(limits.max_tombstones, num_shards)),
+      eviction_thread_(
+          [this](std::stop_token stop_token) { EvictionLoop(stop_token); }) {}
+
+EvalOperationStore::Shard& EvalOperationStore::shardFor(const std::string& name_uuid) {
+  // std::hash rather than absl::Hash, so the shard doesn't correlate with the
+  // bits the shard's own flat_hash_map probes on
+  return shards_[std::hash<std::string>{}(name_uuid) % num_shards];
+}
+
+const EvalOperationStore::Shard& EvalOperationStore::shardFor(const std::string& name_uuid) const {
+  return shards_[std::hash<std::string>{}(name_uuid) % num_shards];
+}
+
+std::shared_ptr<const EvalOperation> EvalOperationStore::createEvalOperation(const std::string& name_uuid) {
+  // everything that doesn't need the lock happens before taking it
+  auto operation_proto = std::make_shared<EvalOperation>();
+  operation_proto->set_name(name_uuid);
+  operation_proto->set_done(false);
   // leave others empty (result and duration)
 
-  auto now = std::chrono::system_clock::now();
-  new_data.creation_time = now;
+  auto new_data = std::make_unique<EvalOperationData>();
+  new_data->creation_time = std::chrono::system_clock::now();
+  std::size_t byte_size = operation_proto->ByteSizeLong();
+  {
+    std::lock_guard<std::mutex> update_lock(new_data->update_mutex);
+    new_data->byte_size = byte_size;
+  }
+  std::shared_ptr<const EvalOperation> snapshot = std::move(operation_proto);
+  new_data->snapshot.store(snapshot);
+
+  Shard& shard = shardFor(name_uuid);
+  {
+    // ensure locked
+    absl::MutexLock lock(&shard.mutex);
+    auto [it, inserted] = shard.operations.try_emplace(name_uuid);
+    if (!inserted) {
+      // uuids don't repeat, but keep the gauges right if one ever does
+      std::lock_guard<std::mutex> update_lock(it->second->update_mutex);
+      shard.total_bytes -= it->second->byte_size;
+      if (!it->second->snapshot.load()->done()) {
+        --shard.num_running;
+      }
+      --shard.num_operations;
+    }
+    it->second = std::move(new_data);
+    shard.creation_order.push_back(name_uuid);
 
-  operations_[name_uuid] = new_data;
-  return new_data.operation_proto;
+    shard.total_bytes += byte_size;
+    ++shard.num_running;
+    ++shard.num_operations;
+  }
+
+  if (shardOverLimits(shard)) {
+    requestEviction();
+  }
+  return snapshot;
 }
 
-std::optional<EvalOperation> EvalOperationStore::getEvalOperation(const std::string& name_uuid) const {
-  std::lock_guard<std::mutex> lock(store_mutex_);
+EvalOperationLookup EvalOperationStore::getEvalOperation(const std::string& name_uuid) const {
+  const Shard& shard = shardFor(name_uuid);
+  absl::ReaderMutexLock lock(&shard.mutex);
 
-  auto it = operations_.find(name_uuid);
+  auto it = shard.operations.find(name_uuid);
   // if (item_found)
-  if (it != operations_.end()) {
-    // return the eval operation
-    return it->second.operation_proto;
+  if (it != shard.operations.end()) {
+    // return the eval operation, callers copy it after the lock is gone
+    return {OperationLookupStatus::FOUND, it->second->snapshot.load()};
   }
 
-  return std::nullopt;
+  if (shard.tombstones.contains(name_uuid)) {
+    return {OperationLookupStatus::EXPIRED, nullptr};
+  }
+  return {OperationLookupStatus::NOT_FOUND, nullptr};
 }
 
 bool EvalOperationStore::updateEvalOperation(const std::string& name_uuid,
                                             const std::function<void(EvalOperation& eval_operation_proto)>& updater) {
-  std::lock_guard<std::mutex> lock(store_mutex_);
-  auto it = operations_.find(name_uuid);
-  if (it != operations_.end()) {
-    updater(it->second.operation_proto);
-    return true;
+  Shard& shard = shardFor(name_uuid);
+  {
+    // shared, the entry can't be evicted or replaced while we hold it, but
+    // readers and updates of other operations carry on
+    absl::ReaderMutexLock lock(&shard.mutex);
+    auto it = shard.operations.find(name_uuid);
+    if (it == shard.operations.end()) {
+      return false;
+    }
+    EvalOperationData& data = *it->second;
+
+    std::lock_guard<std::mutex> update_lock(data.update_mutex);
+    std::shared_ptr<const EvalOperation> current = data.snapshot.load();
+    auto updated = std::make_shared<EvalOperation>(*current);
+    updater(*updated);
+
+    // results are where the bytes are, keep the accounting current
+    std::size_t new_size = updated->ByteSizeLong();
+    shard.total_bytes += new_size;
+    shard.total_bytes -= data.byte_size;
+    data.byte_size = new_size;
+
+    if (current->done() != updated->done()) {
+      if (updated->done()) {
+        data.completion_time = std::chrono::system_clock::now();
+        --shard.num_running;
+      } else {
+        ++shard.num_running;
+      }
+    }
+
+    data.snapshot.store(std::move(updated));
   }
 
-  return false;
+  if (shardOverLimits(shard)) {
+    requestEviction();
+  }
+  return true;
+}
+
+EvalOperationStoreStats EvalOperationStore::getStats() const {
+  EvalOperationStoreStats stats;
+  for (const Shard& shard : shards_) {
+    stats.num_operations += shard.num_operations.load();
+    stats.num_running += shard.num_running.load();
+    stats.total_bytes += shard.total_bytes.load();
+  }
+  stats.num_evicted = num_evicted_.load();
+  return stats;
+}
+
+void EvalOperationStore::EvictionLoop(std::stop_token stop_token) {
+  while (!stop_token.stop_requested()) {
+    {
+      // wakes early on stop or when a create/update crossed a limit. not
+      // waiting on overLimits() itself, running operations can keep a shard
+      // over its limits and that would spin
+      std::unique_lock<std::mutex> lock(eviction_mutex_);
+      eviction_cv_.wait_for(lock, stop_token, limits_.eviction_interval,
+                            [this] { return eviction_requested_; });
+      eviction_requested_ = false;
+    }
+    if (stop_token.stop_requested()) {
+      break;
+    }
+
+    std::size_t evicted_before = num_evicted_.load();
+    auto now = std::chrono::system_clock::now();
+    for (Shard& shard : shards_) {
+      evictShard(shard, now);
+    }
+
+    std::size_t evicted = num_evicted_.load() - evicted_before;
+    if (evicted != 0) {
+      EvalOperationStoreStats stats = getStats();
+      LOG(INFO) << "EvalOperationStore: evicted " << evicted
+                << " operations, " << stats.num_operations
+                << " left using " << stats.total_bytes << " bytes";
+    }
+  }
+}
+
+bool EvalOperationStore::shardOverLimits(const Shard& shard) const {
+  return shard.num_operations.load() > shard_max_entries_ ||
+         shard.total_bytes.load() > shard_max_bytes_;
+}
+
+void EvalOperationStore::requestEviction() {
+  {
+    std::lock_guard<std::mutex> lock(eviction_mutex_);
+    eviction_requested_ = true;
+  }
+  eviction_cv_.notify_one();
+}
+
+void EvalOperationStore::evictShard(Shard& shard, std::chrono::system_clock::time_point now) {
+  // handed to on_evicted_ once the lock is gone
+  std::vector<std::shared_ptr<const EvalOperation>> evicted;
+  {
+    absl::MutexLock lock(&shard.mutex);
+
+    // oldest first: anything done for longer than max_age goes, then more
+    // until the count and byte limits hold again. running operations, and
+    // ones that finished less than max_age ago while the limits hold, are
+    // skipped and keep their place in line
+    //
+    // exclusive lock, so no update is in the middle of an entry and the
+    // snapshots can be read directly
+    std::deque<std::string> kept;
+    while (!shard.creation_order.empty()) {
+      auto it = shard.operations.find(shard.creation_order.front());
+      if (it == shard.operations.end()) {
+        shard.creation_order.pop_front();
+        continue;
+      }
+      EvalOperationData& data = *it->second;
+
+      if (now - data.creation_time <= limits_.max_age &&
+          !shardOverLimits(shard)) {
+        // this one and everything after it was created less than max_age ago,
+        // so can't have finished longer ago than that. nothing more to do
+        break;
+      }
+
+      std::string name_uuid = std::move(shard.creation_order.front());
+      shard.creation_order.pop_front();
+      if (!data.snapshot.load()->done()) {
+        kept.push_back(std::move(name_uuid));
+        continue;
+      }
+
+      {
+        std::lock_guard<std::mutex> update_lock(data.update_mutex);
+        bool expired = now - data.completion_time > limits_.max_age;
+        if (!expired && !shardOverLimits(shard)) {
+          kept.push_back(std::move(name_uuid));
+          continue;
+        }
+        shard.total_bytes -= data.byte_size;
+      }
+      --shard.num_operations;
+      if (on_evicted_) {
+        evicted.push_back(data.snapshot.load());
+      }
+      shard.operations.erase(it);
+      ++num_evicted_;
+      addTombstoneLocked(shard, name_uuid);
+    }
+    // skipped operations go back in front, still oldest first
+    shard.creation_order.insert(shard.creation_order.begin(),
+                                std::make_move_iterator(kept.begin()),
+                                std::make_move_iterator(kept.end()));
+  }
+
+  for (const std::shared_ptr<const EvalOperation>& operation : evicted) {
+    on_evicted_(*operation);
+  }
+}
+
+void EvalOperationStore::addTombstoneLocked(Shard& shard, const std::string& name_uuid) {
+  shard.tombstones.insert(name_uuid);
+  shard.tombstone_order.push_back(name_uuid);
+  while (shard.tombstone_order.size() > shard_max_tombstones_) {
+    shard.tombstones.erase(shard.tombstone_order.front());
+    shard.tombstone_order.pop_front();
+  }
 }
@@ -1,24 +1,91 @@
 #pragma once
 
 #include "reval_service.pb.h"
+#include <array>
+#include <atomic>
 #include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <memory>
 #include <string>
-#include <optional>
 #include <functional>
+#include <stop_token>
+#include <thread>
 #include "absl/container/flat_hash_map.h"
+#include "absl/container/flat_hash_set.h"
+#include "absl/synchronization/mutex.h"
 #include <mutex>
 
 // eval operation data to be stored in the map
+//
+// the proto itself is never modified in place. every update builds a new
+// EvalOperation and swaps the pointer, so a reader that loaded the snapshot
+// can keep using it without holding any lock
 struct EvalOperationData {
-  EvalOperation operation_proto;
+  std::atomic<std::shared_ptr<const EvalOperation>> snapshot;
   std::chrono::system_clock::time_point creation_time;
 
-  // more later  
+  // serializes updates of this one operation (read-copy-update)
+  std::mutex update_mutex;
+  // snapshot->ByteSizeLong(), kept up to date on every update
+  std::size_t byte_size ABSL_GUARDED_BY(update_mutex) = 0;
+  // set by the update that marks it done, max_age counts from here
+  std::chrono::system_clock::time_point completion_time
+      ABSL_GUARDED_BY(update_mutex);
+
+  // more later
+};
+
+// limits enforced by the background eviction pass. only finished (done)
+// operations are ever evicted, a running one always stays until its result
+// has been stored. max_age counts from when the result was stored, so a
+// long-running operation still gets its full max_age to be polled
+//
+// the store is sharded and every shard enforces its even share of the count,
+// byte and tombstone limits, so these are approximate store-wide
+struct EvalOperationStoreLimits {
+  std::chrono::seconds max_age = std::chrono::hours(1);
+  std::size_t max_entries = 10000;
+  // sum of the serialized sizes of all stored operations
+  std::size_t max_total_bytes = std::size_t(512) * 1024 * 1024;
+  std::chrono::milliseconds eviction_interval = std::chrono::seconds(5);
+  // evicted names remembered to answer EXPIRED instead of NOT_FOUND
+  std::size_t max_tombstones = 100000;
+};
+
+enum class OperationLookupStatus { FOUND, NOT_FOUND, EXPIRED };
+
+// called with every operation the eviction pass removed, after the shard lock
+// is released. used to give back the plot references held by its result
+using EvalOperationEvictionCallback =
+    std::function<void(const EvalOperation& evicted_operation)>;
+
+struct EvalOperationLookup {
+  OperationLookupStatus status;
+  // only set when status is FOUND. an immutable snapshot, later updates
+  // don't show up in it
+  std::shared_ptr<const EvalOperation> operation;
+};
+
+// gauges for GetServerStats
+struct EvalOperationStoreStats {
+  std::size_t num_operations = 0;
+  std::size_t num_running = 0;
+  std::size_t total_bytes = 0;
+  // cumulative since startup
+  std::size_t num_evicted = 0;
 };
 
+// uuid -> operation, sharded by hash of the uuid. lookups and updates take
+// their shard's lock shared, only create and eviction take it exclusively.
+// so GetEvalOperation polls don't wait on each other or on the response
+// thread, and never copy the proto while holding a lock
 class EvalOperationStore {
 public:
-  EvalOperationStore() = default;
+  // starts the background eviction thread
+  explicit EvalOperationStore(EvalOperationStoreLimits limits = {},
+                              EvalOperationEvictionCallback on_evicted = nullptr);
 
   // remove the ability to copy or move to prevent any accidental
   // errors. it should be a singleton or essentially unmoving
@@ -27,22 +94,72 @@ public:
 
   // create an operation and store initial state, providing the same
   // uuid from the RTask that is constructed
-  EvalOperation createEvalOperation(const std::string& name_uuid);
+  std::shared_ptr<const EvalOperation> createEvalOperation(const std::string& name_uuid);
 
   // get the operation pointed to by the uuid/name requested
-  // returns an optional which would be empty if operation name not found
-  std::optional<EvalOperation> getEvalOperation(const std::string& name_uuid) const;
+  // NOT_FOUND if the name was never stored, EXPIRED if it was evicted
+  EvalOperationLookup getEvalOperation(const std::string& name_uuid) const;
 
   // updates an EvalOperation in the map by allowing the passing of an
-  // updater function that receives a mutable reference to the EvalOperation
+  // updater function that receives a mutable reference to a copy of the
+  // EvalOperation, which is then published in place of the old one
   bool updateEvalOperation(const std::string& operation_name,
                            const std::function<void(EvalOperation& eval_operation_proto)>& updater);
 
-  // later can consider having a function that removes operations that are too old
-  // based on a set maximum age; probably not important for now.
-  
+  // lock-free, the gauges are kept in atomics
+  EvalOperationStoreStats getStats() const;
 
 private:
-  mutable std::mutex store_mutex_;
-  absl::flat_hash_map<std::string, EvalOperationData> operations_ ABSL_GUARDED_BY(store_mutex_);
+  static constexpr std::size_t num_shards = 16;
+
+  struct Shard {
+    // not std::shared_mutex, whose readers keep getting in ahead of a waiting
+    // writer. absl::Mutex makes new readers wait behind it, so creates and
+    // eviction aren't starved by polls (NOTES.md, store_contention)
+    mutable absl::Mutex mutex;
+    // unique_ptr, the entries hold a mutex and an atomic and can't move
+    absl::flat_hash_map<std::string, std::unique_ptr<EvalOperationData>>
+        operations ABSL_GUARDED_BY(mutex);
+    // names in creation order, oldest first, for the eviction pass
+    std::deque<std::string> creation_order ABSL_GUARDED_BY(mutex);
+
+    absl::flat_hash_set<std::string> tombstones ABSL_GUARDED_BY(mutex);
+    std::deque<std::string> tombstone_order ABSL_GUARDED_BY(mutex);
+
+    // also changed under the shared lock, by updates
+    std::atomic<std::size_t> num_operations = 0;
+    std::atomic<std::size_t> num_running = 0;
+    std::atomic<std::size_t> total_bytes = 0;
+  };
+
+  Shard& shardFor(const std::string& name_uuid);
+  const Shard& shardFor(const std::string& name_uuid) const;
+
+  // background thread, runs evictShard() on every shard every
+  // eviction_interval or as soon as a create/update pushes a shard over its
+  // limits
+  void EvictionLoop(std::stop_token stop_token);
+  void evictShard(Shard& shard, std::chrono::system_clock::time_point now);
+  bool shardOverLimits(const Shard& shard) const;
+  // wakes the eviction thread early
+  void requestEviction();
+  void addTombstoneLocked(Shard& shard, const std::string& name_uuid)
+      ABSL_EXCLUSIVE_LOCKS_REQUIRED(shard.mutex);
+
+  const EvalOperationStoreLimits limits_;
+  const EvalOperationEvictionCallback on_evicted_;
+  // limits_ split evenly over the shards
+  const std::size_t shard_max_entries_;
+  const std::size_t shard_max_bytes_;
+  const std::size_t shard_max_tombstones_;
+
+  std::array<Shard, num_shards> shards_;
+  std::atomic<std::size_t> num_evicted_ = 0;
+
+  std::mutex eviction_mutex_;
+  bool eviction_requested_ ABSL_GUARDED_BY(eviction_mutex_) = false;
+  std::condition_variable_any eviction_cv_;
+
+  // last member, so it is stopped and joined before the rest goes away
+  std::jthread eviction_thread_;
 };
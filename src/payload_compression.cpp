@@ -0,0 +1,150 @@
+#include "payload_compression.h"
+
+#include <memory>
+#include <stdexcept>
+#include <zstd.h>
+
+namespace {
+
+// contexts are reused per thread, creating one per call costs more than
+// compressing a small SVG
+struct ZstdContextDeleter {
+  void operator()(ZSTD_CCtx *context) const { ZSTD_freeCCtx(context); }
+  void operator()(ZSTD_DCtx *context) const { ZSTD_freeDCtx(context); }
+};
+
+ZSTD_CCtx *thread_compression_context() {
+  thread_local std::unique_ptr<ZSTD_CCtx, ZstdContextDeleter> context(
+      ZSTD_createCCtx());
+  return context.get();
+}
+
+ZSTD_DCtx *thread_decompression_context() {
+  thread_local std::unique_ptr<ZSTD_DCtx, ZstdContextDeleter> context(
+      ZSTD_createDCtx());
+  return context.get();
+}
+
+// swaps the output fields of a and b
+void swap_output(EvalResult &a, EvalResult &b) {
+  a.mutable_interpreter_lines()->Swap(b.mutable_interpreter_lines());
+  a.mutable_svg_plots()->Swap(b.mutable_svg_plots());
+  a.mutable_plots()->Swap(b.mutable_plots());
+}
+
+} // namespace
+
+std::string zstd_compress(std::string_view data, int level) {
+  ZSTD_CCtx *context = thread_compression_context();
+  if (context == nullptr) {
+    throw std::runtime_error("ZSTD_createCCtx() failed");
+  }
+
+  std::string compressed;
+  compressed.resize(ZSTD_compressBound(data.size()));
+  std::size_t size =
+      ZSTD_compressCCtx(context, compressed.data(), compressed.size(),
+                        data.data(), data.size(), level);
+  if (ZSTD_isError(size)) {
+    throw std::runtime_error(std::string("zstd compression failed: ") +
+                             ZSTD_getErrorName(size));
+  }
+  // resize() keeps the bound as capacity, about the size of the input. the
+  // plot store and the operation store keep these, so give the rest back
+  compressed.resize(size);
+  compressed.shrink_to_fit();
+  return compressed;
+}
+
+std::string zstd_decompress(std::string_view data) {
+  // our own frames always have the content size, ZSTD_compressCCtx writes it
+  unsigned long long content_size =
+      ZSTD_getFrameContentSize(data.data(), data.size());
+  if (content_size == ZSTD_CONTENTSIZE_ERROR ||
+      content_size == ZSTD_CONTENTSIZE_UNKNOWN) {
+    throw std::runtime_error("not a zstd frame with a known content size");
+  }
+
+  ZSTD_DCtx *context = thread_decompression_context();
+  if (context == nullptr) {
+    throw std::runtime_error("ZSTD_createDCtx() failed");
+  }
+
+  std::string decompressed;
+  decompressed.resize(content_size);
+  std::size_t size =
+      ZSTD_decompressDCtx(context, decompressed.data(), decompressed.size(),
+                          data.data(), data.size());
+  if (ZSTD_isError(size)) {
+    throw std::runtime_error(std::string("zstd decompression failed: ") +
+                             ZSTD_getErrorName(size));
+  }
+  decompressed.resize(size);
+  return decompressed;
+}
+
+bool compress_eval_result(EvalResult &result,
+                          const PayloadCompressionOptions &options) {
+  if (options.zstd_level == 0 ||
+      result.output_encoding() != CONTENT_ENCODING_IDENTITY) {
+    return false;
+  }
+
+  EvalResult output;
+  swap_output(output, result);
+
+  std::string serialized;
+  if (output.ByteSizeLong() < options.min_bytes ||
+      !output.SerializeToString(&serialized)) {
+    swap_output(output, result);
+    return false;
+  }
+
+  std::string compressed;
+  try {
+    compressed = zstd_compress(serialized, options.zstd_level);
+  } catch (const std::exception &) {
+    // the result is still whole, the caller decides whether to log
+    swap_output(output, result);
+    throw;
+  }
+  if (compressed.size() >= serialized.size()) {
+    swap_output(output, result);
+    return false;
+  }
+
+  result.set_output_encoding(CONTENT_ENCODING_ZSTD);
+  result.set_compressed_output(std::move(compressed));
+  return true;
+}
+
+void decompress_eval_result(EvalResult &result) {
+  if (result.output_encoding() == CONTENT_ENCODING_IDENTITY) {
+    return;
+  }
+  if (result.output_encoding() != CONTENT_ENCODING_ZSTD) {
+    throw std::runtime_error("unknown output encoding");
+  }
+
+  EvalResult output;
+  if (!output.ParseFromString(zstd_decompress(result.compressed_output()))) {
+    throw std::runtime_error("compressed output is not an EvalResult");
+  }
+
+  // whatever was already plain (inlined plots) goes after the compressed
+  // output
+  EvalResult plain;
+  swap_output(plain, result);
+  swap_output(result, output);
+  for (std::string &line : *plain.mutable_interpreter_lines()) {
+    result.add_interpreter_lines(std::move(line));
+  }
+  for (std::string &svg : *plain.mutable_svg_plots()) {
+    result.add_svg_plots(std::move(svg));
+  }
+  for (EvalPlot &plot : *plain.mutable_plots()) {
+    *result.add_plots() = std::move(plot);
+  }
+  result.clear_compressed_output();
+  result.set_output_encoding(CONTENT_ENCODING_IDENTITY);
+}
@@ -0,0 +1,46 @@
+#pragma once
+
+#include "reval_service.pb.h"
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+
+// zstd compression of finished eval results
+//
+// the output of a result (interpreter_lines, svg_plots, plots) is compressed
+// once by the response thread, before it goes into the EvalOperationStore,
+// and stays compressed there. clients that list CONTENT_ENCODING_ZSTD in
+// GetEvalOperationRequest.accept_encodings get it like that, everyone else
+// gets it decompressed again by GetEvalOperation (and gRPC's own message
+// compression if the response is big)
+//
+// SVG compresses 5-10x, so this mostly saves store memory and egress on
+// plotting snippets
+
+struct PayloadCompressionOptions {
+  // zstd level, 0 turns compression off. zstd's own default is 3, the higher
+  // levels cost a lot more time for a few % on SVG
+  int zstd_level = 3;
+  // results with less output than this are left alone, the frame overhead
+  // and the client's decompression are not worth it there
+  std::size_t min_bytes = 16 * 1024;
+};
+
+// throws std::runtime_error if zstd fails
+std::string zstd_compress(std::string_view data, int level);
+// throws std::runtime_error on a corrupt frame
+std::string zstd_decompress(std::string_view data);
+
+// moves the output of result into compressed_output (an EvalResult with just
+// the output fields, serialized then compressed) and sets output_encoding.
+// false if it was left as it is, because it is too small, compression is
+// off or it did not get any smaller
+bool compress_eval_result(EvalResult &result,
+                          const PayloadCompressionOptions &options);
+
+// undoes compress_eval_result(), a no-op for a result that isn't compressed.
+// output fields that are set plain next to the compressed ones are kept,
+// after the decompressed ones. throws std::runtime_error if the compressed
+// output is corrupt
+void decompress_eval_result(EvalResult &result);
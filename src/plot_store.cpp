@@ -0,0 +1,188 @@
+#include "plot_store.h"
+#include "payload_compression.h"
+
+#include <absl/log/log.h>
+#include <cstdint>
+#include <cstdlib>
+#include <memory>
+#include <mutex>
+#include <openssl/evp.h>
+#include <stdexcept>
+#include <string_view>
+
+namespace {
+
+// hex SHA-256 over the format and the bytes, so an SVG and a PNG that
+// happen to be byte-identical (never) still get different ids
+std::string plot_id(PlotFormat format, std::string_view data) {
+  uint8_t format_byte = static_cast<uint8_t>(format);
+  unsigned char digest[EVP_MAX_MD_SIZE];
+  unsigned int digest_size = 0;
+
+  std::unique_ptr<EVP_MD_CTX, decltype(&EVP_MD_CTX_free)> context(
+      EVP_MD_CTX_new(), &EVP_MD_CTX_free);
+  if (context == nullptr ||
+      !EVP_DigestInit_ex(context.get(), EVP_sha256(), nullptr) ||
+      !EVP_DigestUpdate(context.get(), &format_byte, 1) ||
+      !EVP_DigestUpdate(context.get(), data.data(), data.size()) ||
+      !EVP_DigestFinal_ex(context.get(), digest, &digest_size)) {
+    throw std::runtime_error("SHA-256 of a plot failed");
+  }
+
+  static constexpr char hex_digits[] = "0123456789abcdef";
+  std::string id;
+  id.reserve(2 * digest_size);
+  for (unsigned int i = 0; i < digest_size; ++i) {
+    unsigned char byte = digest[i];
+    id.push_back(hex_digits[byte >> 4]);
+    id.push_back(hex_digits[byte & 0xf]);
+  }
+  return id;
+}
+
+// value of attribute name in the first tag starting with tag_start, e.g.
+// width='720.00pt' in svglite's <svg ...> tag. 0 if it isn't there
+double tag_attribute_number(std::string_view data, std::string_view tag_start,
+                            std::string_view name) {
+  std::size_t tag = data.find(tag_start);
+  if (tag == std::string_view::npos) {
+    return 0;
+  }
+  std::size_t tag_end = data.find('>', tag);
+  std::string_view tag_text = data.substr(tag, tag_end - tag);
+
+  std::string needle = " " + std::string(name) + "=";
+  std::size_t attribute = tag_text.find(needle);
+  if (attribute == std::string_view::npos) {
+    return 0;
+  }
+  // past the quote after name=
+  std::size_t value = attribute + needle.size() + 1;
+  if (value >= tag_text.size()) {
+    return 0;
+  }
+  // strtod stops at the unit or the closing quote
+  std::string value_text(tag_text.substr(value, 32));
+  return std::strtod(value_text.c_str(), nullptr);
+}
+
+uint32_t big_endian_u32(std::string_view data, std::size_t offset) {
+  return (static_cast<uint32_t>(static_cast<unsigned char>(data[offset])) << 24) |
+         (static_cast<uint32_t>(static_cast<unsigned char>(data[offset + 1])) << 16) |
+         (static_cast<uint32_t>(static_cast<unsigned char>(data[offset + 2])) << 8) |
+         static_cast<uint32_t>(static_cast<unsigned char>(data[offset + 3]));
+}
+
+// width and height of the plot, points for SVG and pixels for PNG, left at 0
+// if they can't be read
+void set_plot_dimensions(PlotRef &ref, std::string_view data) {
+  if (ref.format() == PLOT_FORMAT_PNG) {
+    // 8 byte signature, then IHDR: length, type, width, height
+    if (data.size() >= 24 && data.substr(12, 4) == "IHDR") {
+      ref.set_width(big_endian_u32(data, 16));
+      ref.set_height(big_endian_u32(data, 20));
+    }
+    return;
+  }
+  ref.set_width(tag_attribute_number(data, "<svg", "width"));
+  ref.set_height(tag_attribute_number(data, "<svg", "height"));
+}
+
+} // namespace
+
+PlotStore::PlotStore(int zstd_level) : zstd_level_(zstd_level) {}
+
+PlotRef PlotStore::putPlot(PlotFormat format, std::string data) {
+  std::string id = plot_id(format, data);
+
+  {
+    std::unique_lock<std::shared_mutex> lock(mutex_);
+    auto it = plots_.find(id);
+    if (it != plots_.end()) {
+      ++it->second.refs;
+      ++num_deduplicated_;
+      return it->second.plot->ref;
+    }
+  }
+
+  // new plot, built without the lock
+  auto plot = std::make_shared<StoredPlot>();
+  plot->ref.set_id(id);
+  plot->ref.set_format(format);
+  plot->ref.set_size_bytes(data.size());
+  set_plot_dimensions(plot->ref, data);
+
+  plot->data = std::move(data);
+  if (format == PLOT_FORMAT_SVG && zstd_level_ != 0) {
+    try {
+      std::string compressed = zstd_compress(plot->data, zstd_level_);
+      if (compressed.size() < plot->data.size()) {
+        plot->data = std::move(compressed);
+        plot->encoding = CONTENT_ENCODING_ZSTD;
+      }
+    } catch (const std::exception &e) {
+      LOG(WARNING) << "PlotStore: storing plot " << id
+                   << " uncompressed: " << e.what();
+    }
+  }
+
+  std::unique_lock<std::shared_mutex> lock(mutex_);
+  auto [it, inserted] = plots_.try_emplace(id);
+  if (inserted) {
+    total_bytes_ += plot->data.size();
+    it->second.plot = std::move(plot);
+  } else {
+    // someone stored the same plot meanwhile
+    ++num_deduplicated_;
+  }
+  ++it->second.refs;
+  return it->second.plot->ref;
+}
+
+std::shared_ptr<const StoredPlot> PlotStore::getPlot(const std::string &id) const {
+  std::shared_lock<std::shared_mutex> lock(mutex_);
+  auto it = plots_.find(id);
+  if (it == plots_.end()) {
+    return nullptr;
+  }
+  return it->second.plot;
+}
+
+void PlotStore::releasePlot(const std::string &id) {
+  std::unique_lock<std::shared_mutex> lock(mutex_);
+  auto it = plots_.find(id);
+  if (it == plots_.end()) {
+    LOG(WARNING) << "PlotStore: released plot " << id << " is not stored";
+    return;
+  }
+  if (--it->second.refs == 0) {
+    total_bytes_ -= it->second.plot->data.size();
+    plots_.erase(it);
+  }
+}
+
+void PlotStore::releasePlots(const EvalResult &result) {
+  for (const PlotRef &ref : result.plot_refs()) {
+    releasePlot(ref.id());
+  }
+}
+
+PlotStoreCounters PlotStore::getStats() const {
+  std::shared_lock<std::shared_mutex> lock(mutex_);
+  PlotStoreCounters stats;
+  stats.num_plots = plots_.size();
+  stats.total_bytes = total_bytes_;
+  stats.num_deduplicated = num_deduplicated_;
+  return stats;
+}
+
+std::string decoded_plot_data(const StoredPlot &plot) {
+  switch (plot.encoding) {
+  case CONTENT_ENCODING_IDENTITY:
+    return plot.data;
+  case CONTENT_ENCODING_ZSTD:
+    return zstd_decompress(plot.data);
+  default:
+    throw std::runtime_error("unknown plot encoding");
+  }
+}
@@ -0,0 +1,80 @@
+#pragma once
+
+#include "reval_service.pb.h"
+#include "absl/base/thread_annotations.h"
+#include "absl/container/flat_hash_map.h"
+
+#include <cstddef>
+#include <memory>
+#include <shared_mutex>
+#include <string>
+
+// content-addressed store of rendered plots
+//
+// every plot of a finished evaluation goes in here once, keyed by the
+// SHA-256 of its format and bytes, and the EvalResult in the
+// EvalOperationStore only keeps a PlotRef to it. agents re-run the same
+// plotting code a lot, so the same SVG is stored once no matter how many
+// operations produced it. each operation holds one reference per plot and
+// gives it back when it is evicted, a plot goes away with its last reference
+//
+// plots are read with GetPlot in chunks, so a multi-MB plot never has to fit
+// into one gRPC message
+
+struct StoredPlot {
+  // id, format, size and dimensions, as handed out in EvalResult.plot_refs
+  PlotRef ref;
+  // how data is stored. SVG is zstd compressed, PNG already is
+  ContentEncoding encoding = CONTENT_ENCODING_IDENTITY;
+  std::string data;
+};
+
+struct PlotStoreCounters {
+  std::size_t num_plots = 0;
+  // stored (compressed) bytes
+  std::size_t total_bytes = 0;
+  // cumulative since startup, puts that found the plot already stored
+  std::size_t num_deduplicated = 0;
+};
+
+class PlotStore {
+public:
+  // zstd_level for the stored SVGs, 0 stores them as they are
+  explicit PlotStore(int zstd_level = 3);
+
+  PlotStore(const PlotStore &) = delete;
+  PlotStore &operator=(const PlotStore &) = delete;
+
+  // stores the plot, or finds the identical one, and takes a reference on
+  // it. hashing and compression happen outside the lock
+  PlotRef putPlot(PlotFormat format, std::string data);
+
+  // null if there is no such plot (anymore). the StoredPlot is immutable and
+  // stays valid after its last reference is released
+  std::shared_ptr<const StoredPlot> getPlot(const std::string &id) const;
+
+  // gives back one reference taken by putPlot()
+  void releasePlot(const std::string &id);
+  // gives back the references of all of result's plot_refs, for an
+  // evicted operation
+  void releasePlots(const EvalResult &result);
+
+  PlotStoreCounters getStats() const;
+
+private:
+  struct Entry {
+    std::shared_ptr<const StoredPlot> plot;
+    std::size_t refs = 0;
+  };
+
+  const int zstd_level_;
+
+  mutable std::shared_mutex mutex_;
+  absl::flat_hash_map<std::string, Entry> plots_ ABSL_GUARDED_BY(mutex_);
+  std::size_t total_bytes_ ABSL_GUARDED_BY(mutex_) = 0;
+  std::size_t num_deduplicated_ ABSL_GUARDED_BY(mutex_) = 0;
+};
+
+// the plot's bytes as they were rendered, decompressed if need be. throws
+// std::runtime_error if the stored data is corrupt
+std::string decoded_plot_data(const StoredPlot &plot);
@@ -0,0 +1,112 @@
+#include "r_console_output.h"
+
+#include <algorithm>
+#include <utility>
+
+namespace RWorker {
+
+namespace {
+
+// the start of a UTF-8 sequence at or before pos, so a cut never splits a
+// character
+std::size_t utf8_boundary(std::string_view text, std::size_t pos) {
+  while (pos > 0 && pos < text.size() &&
+         (static_cast<unsigned char>(text[pos]) & 0xC0) == 0x80) {
+    --pos;
+  }
+  return pos;
+}
+
+std::string omitted_marker(std::size_t lines, std::size_t bytes) {
+  std::string marker = "... [output truncated: ";
+  if (lines > 0) {
+    marker += std::to_string(lines) + " lines, ";
+  }
+  marker += std::to_string(bytes) + " bytes omitted] ...";
+  return marker;
+}
+
+} // namespace
+
+ConsoleOutputBuffer::ConsoleOutputBuffer(OutputLimits limits) {
+  // at least a line and a few bytes on each side, whatever the limits say
+  limits.max_lines = std::max<std::size_t>(limits.max_lines, 2);
+  limits.max_bytes = std::max<std::size_t>(limits.max_bytes, 256);
+  head_max_lines_ = limits.max_lines / 2;
+  head_max_bytes_ = limits.max_bytes / 2;
+  tail_max_lines_ = limits.max_lines - head_max_lines_;
+  tail_max_bytes_ = limits.max_bytes - head_max_bytes_;
+}
+
+void ConsoleOutputBuffer::push_back(std::string_view line) {
+  ++sizes_.total_lines;
+  sizes_.total_bytes += line.size();
+
+  if (!head_full_ && head_.size() < head_max_lines_ &&
+      head_bytes_ + line.size() <= head_max_bytes_) {
+    head_.emplace_back(line);
+    head_bytes_ += line.size();
+    return;
+  }
+  head_full_ = true;
+  push_tail(line);
+}
+
+void ConsoleOutputBuffer::push_tail(std::string_view line) {
+  if (line.size() > tail_max_bytes_) {
+    // start and end of the line, the middle goes. half the tail at most,
+    // so that the lines after it don't push it out right away
+    std::size_t keep = tail_max_bytes_ / 4;
+    std::size_t head_end = utf8_boundary(line, keep);
+    std::size_t tail_start = utf8_boundary(line, line.size() - keep);
+    std::size_t omitted = tail_start - head_end;
+
+    std::string shortened(line.substr(0, head_end));
+    shortened += "\n" + omitted_marker(0, omitted) + "\n";
+    shortened += line.substr(tail_start);
+
+    sizes_.truncated = true;
+    // goes in as if the line had been this long, it may still push other
+    // lines out
+    tail_bytes_ += shortened.size();
+    tail_.push_back(std::move(shortened));
+  } else {
+    tail_bytes_ += line.size();
+    tail_.emplace_back(line);
+  }
+
+  // the newest line always stays
+  while (tail_.size() > 1 &&
+         (tail_.size() > tail_max_lines_ || tail_bytes_ > tail_max_bytes_)) {
+    tail_bytes_ -= tail_.front().size();
+    dropped_bytes_ += tail_.front().size();
+    ++dropped_lines_;
+    tail_.pop_front();
+  }
+}
+
+std::vector<std::string> ConsoleOutputBuffer::take_lines() {
+  std::vector<std::string> lines = std::move(head_);
+  lines.reserve(lines.size() + tail_.size() + 1);
+  if (dropped_lines_ > 0) {
+    sizes_.truncated = true;
+    lines.push_back(omitted_marker(dropped_lines_, dropped_bytes_));
+  }
+  for (std::string &line : tail_) {
+    lines.push_back(std::move(line));
+  }
+
+  sizes_.retained_lines = lines.size();
+  sizes_.retained_bytes = 0;
+  for (const std::string &line : lines) {
+    sizes_.retained_bytes += line.size();
+  }
+
+  head_.clear();
+  head_bytes_ = 0;
+  tail_.clear();
+  tail_bytes_ = 0;
+  return lines;
+}
+
+} // namespace RWorker
@@ -0,0 +1,61 @@
+#pragma once
+
+#include "r_result.h"
+
+#include <cstddef>
+#include <deque>
+#include <string>
+#include <string_view>
+#include <vector>
+
+// console output of one evaluation, bounded by the task's OutputLimits
+//
+// a print(1:1e7) or a chatty loop used to go into the response whole, through
+// the worker, the IPC socket, the response queue and the operation store.
+// now only the head and the tail of the output are kept, each gets half of
+// the line and byte limits. lines go to the head until it is full and to the
+// tail after that, the tail drops its oldest lines to make room. what was
+// dropped is replaced by one marker line between the two.
+//
+// a single line bigger than the tail's byte limit (one print() of a huge
+// vector) keeps its own start and end, with a marker where the middle was
+
+namespace RWorker {
+
+class ConsoleOutputBuffer {
+public:
+  explicit ConsoleOutputBuffer(OutputLimits limits = {});
+
+  // copies only the part of line that is kept
+  void push_back(std::string_view line);
+
+  // the kept lines in order, with the markers. leaves the buffer empty
+  std::vector<std::string> take_lines();
+
+  // valid until take_lines(), which fills in the retained sizes
+  const ConsoleOutputSizes &sizes() const { return sizes_; }
+
+private:
+  void push_tail(std::string_view line);
+
+  std::size_t head_max_lines_;
+  std::size_t head_max_bytes_;
+  std::size_t tail_max_lines_;
+  std::size_t tail_max_bytes_;
+
+  std::vector<std::string> head_;
+  std::size_t head_bytes_ = 0;
+  // no more lines go to the head once one didn't fit, the order would break
+  bool head_full_ = false;
+
+  std::deque<std::string> tail_;
+  std::size_t tail_bytes_ = 0;
+
+  // dropped from between head and tail
+  std::size_t dropped_lines_ = 0;
+  std::size_t dropped_bytes_ = 0;
+
+  ConsoleOutputSizes sizes_;
+};
+
+} // namespace RWorker
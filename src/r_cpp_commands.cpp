@@ -0,0 +1,370 @@
+#include "r_cpp_commands.h"
+
+#include <R/Rinternals.h>
+#include <R_ext/Memory.h>
+#include <cpp11.hpp>
+
+#include <algorithm>
+#include <charconv>
+#include <exception>
+#include <fstream>
+#include <malloc.h>
+#include <stdexcept>
+#include <string_view>
+#include <type_traits>
+#include <unistd.h>
+#include <utility>
+#include <vector>
+
+namespace RWorker {
+
+void WorkerCounters::count(TaskType type, ResponseStatus status) {
+  auto index = static_cast<std::size_t>(type);
+  if (index < tasks_by_type.size()) {
+    ++tasks_by_type[index];
+  }
+  switch (status) {
+  case ResponseStatus::SUCCESS:
+    break;
+  case ResponseStatus::CANCELLED:
+    ++tasks_cancelled;
+    break;
+  case ResponseStatus::FAILURE_TIMEOUT:
+    ++tasks_timed_out;
+    break;
+  case ResponseStatus::EXPIRED:
+    ++tasks_expired;
+    break;
+  default:
+    ++tasks_failed;
+    break;
+  }
+}
+
+namespace {
+
+// one key=value line of a command's output
+template <typename Value>
+void add_field(std::string &output, std::string_view key, const Value &value) {
+  output.append(key);
+  output.push_back('=');
+  if constexpr (std::is_convertible_v<const Value &, std::string_view>) {
+    output.append(std::string_view(value));
+  } else {
+    output.append(std::to_string(value));
+  }
+  output.push_back('\n');
+}
+
+// resident set size from /proc, 0 if it can't be read
+uint64_t rss_bytes() {
+  std::ifstream statm("/proc/self/statm");
+  uint64_t size_pages = 0;
+  uint64_t resident_pages = 0;
+  if (!(statm >> size_pages >> resident_pages)) {
+    return 0;
+  }
+  return resident_pages * static_cast<uint64_t>(sysconf(_SC_PAGESIZE));
+}
+
+// R keeps its cons/vector cell counts to itself (gc() reads them through
+// the evaluator), but it allocates its pages and every large vector with
+// malloc, so the allocator's numbers are R's heap plus a little of ours
+struct MallocUsage {
+  // in small-block arenas, R's node pages and small vectors
+  uint64_t in_use_bytes = 0;
+  // mmap()ed blocks, large vectors
+  uint64_t mmap_bytes = 0;
+  // kept by the allocator for reuse
+  uint64_t free_bytes = 0;
+
+  uint64_t total() const { return in_use_bytes + mmap_bytes; }
+};
+
+MallocUsage malloc_usage() {
+  struct mallinfo2 info = mallinfo2();
+  return MallocUsage{info.uordblks, info.hblkhd, info.fordblks};
+}
+
+std::string command_echo(const std::vector<std::string> &arguments,
+                         const WorkerCounters &) {
+  if (arguments.empty()) {
+    throw std::invalid_argument("echo needs an argument");
+  }
+  return arguments.front();
+}
+
+std::string command_gc(const std::vector<std::string> &,
+                       const WorkerCounters &) {
+  MallocUsage before = malloc_usage();
+  uint64_t rss_before = rss_bytes();
+  // a full collection, finalizers included
+  cpp11::safe[R_gc]();
+  MallocUsage after = malloc_usage();
+
+  std::string output;
+  add_field(output, "reclaimed_bytes",
+            before.total() > after.total() ? before.total() - after.total()
+                                           : 0);
+  add_field(output, "heap_bytes_before", before.total());
+  add_field(output, "heap_bytes_after", after.total());
+  add_field(output, "rss_bytes_before", rss_before);
+  add_field(output, "rss_bytes_after", rss_bytes());
+  return output;
+}
+
+std::string command_heap(const std::vector<std::string> &,
+                         const WorkerCounters &) {
+  MallocUsage usage = malloc_usage();
+  std::string output;
+  add_field(output, "heap_bytes", usage.total());
+  add_field(output, "small_block_bytes", usage.in_use_bytes);
+  add_field(output, "large_vector_bytes", usage.mmap_bytes);
+  add_field(output, "free_bytes", usage.free_bytes);
+  add_field(output, "rss_bytes", rss_bytes());
+  return output;
+}
+
+// the same ballpark as utils::object.size(), not byte for byte: node and
+// vector headers as on 64-bit R, vector data rounded to 8 bytes, strings
+// counted every time they occur. environments aren't followed. ALTREP
+// vectors are counted by length and never expanded, their elements aren't
+// looked at
+constexpr uint64_t node_bytes = 56;
+constexpr uint64_t vector_header_bytes = 48;
+
+uint64_t vector_bytes(uint64_t data_bytes) {
+  return vector_header_bytes + (data_bytes + 7) / 8 * 8;
+}
+
+uint64_t object_bytes(SEXP object) {
+  uint64_t bytes = 0;
+  std::vector<SEXP> pending{object};
+  while (!pending.empty()) {
+    SEXP x = pending.back();
+    pending.pop_back();
+    if (x == R_NilValue) {
+      continue;
+    }
+    if (ATTRIB(x) != R_NilValue) {
+      pending.push_back(ATTRIB(x));
+    }
+
+    auto length = static_cast<uint64_t>(Rf_xlength(x));
+    switch (TYPEOF(x)) {
+    case LGLSXP:
+    case INTSXP:
+      bytes += vector_bytes(length * sizeof(int));
+      break;
+    case REALSXP:
+      bytes += vector_bytes(length * sizeof(double));
+      break;
+    case CPLXSXP:
+      bytes += vector_bytes(length * sizeof(Rcomplex));
+      break;
+    case RAWSXP:
+      bytes += vector_bytes(length);
+      break;
+    case CHARSXP:
+      bytes += vector_bytes(static_cast<uint64_t>(LENGTH(x)) + 1);
+      break;
+    case STRSXP:
+      bytes += vector_bytes(length * sizeof(SEXP));
+      if (!ALTREP(x)) {
+        for (R_xlen_t i = 0; i < XLENGTH(x); ++i) {
+          pending.push_back(STRING_ELT(x, i));
+        }
+      }
+      break;
+    case VECSXP:
+    case EXPRSXP:
+      bytes += vector_bytes(length * sizeof(SEXP));
+      if (!ALTREP(x)) {
+        for (R_xlen_t i = 0; i < XLENGTH(x); ++i) {
+          pending.push_back(VECTOR_ELT(x, i));
+        }
+      }
+      break;
+    case LISTSXP:
+    case LANGSXP:
+      // the spine here, the elements as they come up
+      for (SEXP node = x; node != R_NilValue; node = CDR(node)) {
+        bytes += node_bytes;
+        pending.push_back(CAR(node));
+        if (node != x && ATTRIB(node) != R_NilValue) {
+          pending.push_back(ATTRIB(node));
+        }
+      }
+      break;
+    case CLOSXP:
+      bytes += node_bytes;
+      pending.push_back(FORMALS(x));
+      pending.push_back(BODY(x));
+      break;
+    default:
+      // symbols, environments, external pointers, builtins, ...
+      bytes += node_bytes;
+      break;
+    }
+  }
+  return bytes;
+}
+
+std::string command_object_sizes(const std::vector<std::string> &arguments,
+                                  const WorkerCounters &) {
+  std::size_t limit = 20;
+  if (!arguments.empty()) {
+    const std::string &argument = arguments.front();
+    auto [end, error] =
+        std::from_chars(argument.data(), argument.data() + argument.size(),
+                        limit);
+    if (error != std::errc() || end != argument.data() + argument.size()) {
+      throw std::invalid_argument("object_sizes takes a number of objects, "
+                                  "not '" + argument + "'");
+    }
+  }
+
+  SEXP client_env = cpp11::safe[Rf_findVarInFrame](R_GlobalEnv,
+                                                   Rf_install("client_env"));
+  if (TYPEOF(client_env) != ENVSXP) {
+    throw std::runtime_error("The session has no client_env");
+  }
+
+  cpp11::sexp names = cpp11::safe[R_lsInternal3](client_env, TRUE, FALSE);
+  std::vector<std::pair<uint64_t, std::string>> sizes;
+  sizes.reserve(static_cast<std::size_t>(XLENGTH(names)));
+  uint64_t total_bytes = 0;
+  uint64_t skipped = 0;
+  for (R_xlen_t i = 0; i < XLENGTH(names); ++i) {
+    SEXP symbol = cpp11::safe[Rf_installChar](STRING_ELT(names, i));
+    // an active binding would run its function, a promise its code
+    if (R_BindingIsActive(symbol, client_env)) {
+      ++skipped;
+      continue;
+    }
+    SEXP value = Rf_findVarInFrame(client_env, symbol);
+    if (TYPEOF(value) == PROMSXP) {
+      ++skipped;
+      continue;
+    }
+    uint64_t bytes = object_bytes(value);
+    total_bytes += bytes;
+    sizes.emplace_back(bytes, CHAR(STRING_ELT(names, i)));
+  }
+
+  std::size_t shown = std::min(limit, sizes.size());
+  std::partial_sort(sizes.begin(), sizes.begin() + shown, sizes.end(),
+                    [](const auto &a, const auto &b) { return a.first > b.first; });
+
+  std::string output;
+  add_field(output, "objects", sizes.size());
+  add_field(output, "total_bytes", total_bytes);
+  add_field(output, "not_evaluated", skipped);
+  for (std::size_t i = 0; i < shown; ++i) {
+    add_field(output, sizes[i].second, sizes[i].first);
+  }
+  return output;
+}
+
+std::string command_uptime(const std::vector<std::string> &,
+                           const WorkerCounters &counters) {
+  auto uptime = std::chrono::duration_cast<std::chrono::seconds>(
+      std::chrono::steady_clock::now() - counters.started_at);
+
+  std::string output;
+  add_field(output, "pid", static_cast<int64_t>(getpid()));
+  add_field(output, "uptime_seconds", static_cast<int64_t>(uptime.count()));
+  add_field(output, "tasks_client",
+            counters.tasks_by_type[static_cast<std::size_t>(
+                TaskType::EXECUTE_R_CODE_CLIENT)]);
+  add_field(output, "tasks_management",
+            counters.tasks_by_type[static_cast<std::size_t>(
+                TaskType::EXECUTE_R_CODE_MANAGEMENT)]);
+  add_field(output, "tasks_cpp",
+            counters.tasks_by_type[static_cast<std::size_t>(
+                TaskType::CPP_MANAGEMENT_TASK)]);
+  add_field(output, "tasks_view_table",
+            counters.tasks_by_type[static_cast<std::size_t>(
+                TaskType::VIEW_TABLE)]);
+  add_field(output, "tasks_batch",
+            counters.tasks_by_type[static_cast<std::size_t>(
+                TaskType::EXECUTE_R_CODE_BATCH)]);
+  add_field(output, "tasks_failed", counters.tasks_failed);
+  add_field(output, "tasks_cancelled", counters.tasks_cancelled);
+  add_field(output, "tasks_timed_out", counters.tasks_timed_out);
+  add_field(output, "tasks_expired", counters.tasks_expired);
+  return output;
+}
+
+using CppCommandHandler = std::string (*)(const std::vector<std::string> &,
+                                          const WorkerCounters &);
+
+struct CppCommand {
+  std::string_view name;
+  CppCommandHandler run;
+};
+
+// every command there is. a new one only needs its handler and a line here,
+// the lookup is a scan of a handful of names
+constexpr std::array<CppCommand, 5> cpp_commands{{
+    {"echo", command_echo},
+    {"gc", command_gc},
+    {"heap", command_heap},
+    {"object_sizes", command_object_sizes},
+    {"uptime", command_uptime},
+}};
+
+constexpr bool cpp_command_names_unique() {
+  for (std::size_t i = 0; i < cpp_commands.size(); ++i) {
+    for (std::size_t j = i + 1; j < cpp_commands.size(); ++j) {
+      if (cpp_commands[i].name == cpp_commands[j].name) {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+static_assert(cpp_command_names_unique(), "two C++ commands share a name");
+
+constexpr const CppCommand *find_cpp_command(std::string_view name) {
+  for (const CppCommand &command : cpp_commands) {
+    if (command.name == name) {
+      return &command;
+    }
+  }
+  return nullptr;
+}
+static_assert(find_cpp_command("echo") != nullptr);
+
+} // namespace
+
+std::unique_ptr<RResponse> run_cpp_command(const CppManagementPayload &payload,
+                                           std::string task_uuid,
+                                           const WorkerCounters &counters) {
+  const CppCommand *command = find_cpp_command(payload.command_identifier);
+  if (command == nullptr) {
+    return std::make_unique<RResponse>(
+        std::move(task_uuid), ResponseStatus::FAILURE_INVALID_TASK,
+        ManagementTaskResultPayload{},
+        "Unknown command '" + payload.command_identifier + "'");
+  }
+
+  std::string output;
+  try {
+    output = command->run(payload.arguments, counters);
+  } catch (const cpp11::unwind_exception &) {
+    return std::make_unique<RResponse>(
+        std::move(task_uuid), ResponseStatus::FAILURE_CPP_COMMAND,
+        ManagementTaskResultPayload{},
+        "R error while running '" + payload.command_identifier + "'");
+  } catch (const std::exception &e) {
+    return std::make_unique<RResponse>(std::move(task_uuid),
+                                       ResponseStatus::FAILURE_CPP_COMMAND,
+                                       ManagementTaskResultPayload{}, e.what());
+  }
+  return std::make_unique<RResponse>(std::move(task_uuid),
+                                     ResponseStatus::SUCCESS,
+                                     ManagementTaskResultPayload{std::move(output)});
+}
+
+} // namespace RWorker
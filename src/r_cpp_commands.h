@@ -0,0 +1,44 @@
+#pragma once
+
+#include "r_result.h"
+#include "r_task.h"
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <string>
+
+namespace RWorker {
+
+// what a worker has done since it started, for the uptime command. kept by
+// r_worker_loop, R thread only
+struct WorkerCounters {
+  std::chrono::steady_clock::time_point started_at =
+      std::chrono::steady_clock::now();
+  // finished tasks by TaskType
+  std::array<uint64_t, 5> tasks_by_type{};
+  uint64_t tasks_failed = 0;
+  uint64_t tasks_cancelled = 0;
+  uint64_t tasks_timed_out = 0;
+  uint64_t tasks_expired = 0;
+
+  void count(TaskType type, ResponseStatus status);
+};
+
+// CPP_MANAGEMENT_TASK: runs payload.command_identifier from the command
+// table in r_cpp_commands.cpp. the commands are probes for monitoring, they
+// read R's state from C and never go through the evaluator:
+// - echo <text>: sends back its first argument
+// - gc: full collection, with the bytes it gave back
+// - heap: the process' malloc numbers (in use, mmap()ed, free) and its RSS
+// - object_sizes [n]: the n (default 20) biggest objects in client_env
+// - uptime: worker uptime and WorkerCounters
+// the output is key=value lines in the ManagementTaskResultPayload.
+// FAILURE_INVALID_TASK for an unknown command, FAILURE_CPP_COMMAND with the
+// reason if it failed. R thread only
+std::unique_ptr<RResponse> run_cpp_command(const CppManagementPayload &payload,
+                                           std::string task_uuid,
+                                           const WorkerCounters &counters);
+
+} // namespace RWorker
@@ -1,16 +1,473 @@
 #include "cpp11/as.hpp"
+#include "r_eval.h"
+#include "r_console_output.h"
+#include "r_plot_render.h"
 #include "r_result.h"
+#include "r_task_control.h"
 
 #include <R/Rinternals.h>
+#include <R_ext/Parse.h>
+#include <R_ext/Rdynload.h>
 #include <cpp11.hpp>
 
 #include <iostream>
 #include <memory>
 #include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <optional>
+#include <stdexcept>
+#include <string_view>
+#include <vector>
 
 
 namespace RWorker {
 
+namespace {
+// what an item of the evaluate() result is, from its class attribute
+enum class EvalItemKind { SOURCE, TEXT, PLOT, ERROR, WARNING, MESSAGE, OTHER };
+
+// reads the class attribute in C instead of calling class() per item. same
+// mapping as before: a plain character vector (implicit class "character")
+// is text, anything else by what it inherits from
+EvalItemKind classify_eval_item(SEXP item) {
+  SEXP klass = Rf_getAttrib(item, R_ClassSymbol);
+  if (klass == R_NilValue) {
+    return TYPEOF(item) == STRSXP ? EvalItemKind::TEXT : EvalItemKind::OTHER;
+  }
+  if (Rf_inherits(item, "source")) {
+    return EvalItemKind::SOURCE;
+  }
+  if (Rf_inherits(item, "recordedplot")) {
+    return EvalItemKind::PLOT;
+  }
+  if (Rf_inherits(item, "error")) {
+    return EvalItemKind::ERROR;
+  }
+  if (Rf_inherits(item, "warning")) {
+    return EvalItemKind::WARNING;
+  }
+  if (Rf_inherits(item, "message")) {
+    return EvalItemKind::MESSAGE;
+  }
+  return EvalItemKind::OTHER;
+}
+
+// element of a named list, R_NilValue if there is none
+SEXP list_element(SEXP list, const char *name) {
+  if (TYPEOF(list) != VECSXP) {
+    return R_NilValue;
+  }
+  SEXP names = Rf_getAttrib(list, R_NamesSymbol);
+  if (TYPEOF(names) != STRSXP) {
+    return R_NilValue;
+  }
+  for (R_xlen_t i = 0; i < XLENGTH(list); ++i) {
+    if (std::strcmp(CHAR(STRING_ELT(names, i)), name) == 0) {
+      return VECTOR_ELT(list, i);
+    }
+  }
+  return R_NilValue;
+}
+
+// CHARSXP to UTF-8. ASCII/UTF-8 strings (the usual case) are read in
+// place, only other encodings go back into R to be translated
+std::string char_to_utf8(SEXP charsxp) {
+  if (charsxp == NA_STRING) {
+    return "NA";
+  }
+  if (Rf_charIsUTF8(charsxp)) {
+    return std::string(CHAR(charsxp), LENGTH(charsxp));
+  }
+  return cpp11::safe[Rf_translateCharUTF8](charsxp);
+}
+
+// message of an error/warning/message condition. base R's simple conditions
+// (stop(), warning(), message()) keep it in their "message" element, read
+// that directly. other condition classes can have a conditionMessage()
+// method that formats more than that (rlang does), those still go through R
+std::optional<std::string>
+condition_message(SEXP condition,
+                  const cpp11::function &base_condition_message) {
+  SEXP message_sexp = R_NilValue;
+  if (Rf_inherits(condition, "simpleError") ||
+      Rf_inherits(condition, "simpleWarning") ||
+      Rf_inherits(condition, "simpleMessage")) {
+    message_sexp = list_element(condition, "message");
+  }
+
+  cpp11::sexp called_message;
+  if (TYPEOF(message_sexp) != STRSXP) {
+    called_message = base_condition_message(condition);
+    message_sexp = called_message;
+  }
+
+  if (TYPEOF(message_sexp) != STRSXP || XLENGTH(message_sexp) == 0) {
+    return std::nullopt;
+  }
+  return char_to_utf8(STRING_ELT(message_sexp, 0));
+}
+
+// R objects every evaluation needs, looked up once after exec_R_setup()
+// instead of a namespace lookup per function per evaluation. the
+// cpp11::function members keep their SEXPs preserved, and the struct is never
+// destroyed, so they stay valid for the life of the interpreter (and of the
+// workers forked from the zygote, which inherit them)
+struct REvalHandles {
+  cpp11::function evaluate_evaluate;
+  cpp11::function evaluate_trim_plots;
+  cpp11::function base_condition_message;
+  cpp11::function base_geterrmessage;
+  // .harness_render_svg and .harness_render_png, defined by RSetup
+  cpp11::function render_svg;
+  cpp11::function render_png;
+  // .harness_stream_output_handler, defined by RSetup, for streaming
+  // evaluations. the others use evaluate's default handler
+  cpp11::sexp stream_output_handler;
+  // the environment client code is evaluated in, global_env$client_env
+  cpp11::sexp client_env;
+};
+
+REvalHandles *eval_handles = nullptr;
+
+const REvalHandles &r_eval_handles() {
+  if (eval_handles == nullptr) {
+    throw std::logic_error("init_r_eval_handles() was not called");
+  }
+  return *eval_handles;
+}
+
+// the items evaluate() has handed to the streaming output handler so far, in
+// a growing list kept on the C side. evaluate() only returns its result at
+// the end, an interrupted streaming evaluation is left with this. R thread
+// only
+class PartialOutput {
+public:
+  PartialOutput() = default;
+  PartialOutput(const PartialOutput &) = delete;
+  PartialOutput &operator=(const PartialOutput &) = delete;
+  ~PartialOutput() {
+    if (items_ != R_NilValue) {
+      R_ReleaseObject(items_);
+    }
+  }
+
+  void push(SEXP item) {
+    if (items_ == R_NilValue || size_ == XLENGTH(items_)) {
+      grow();
+    }
+    SET_VECTOR_ELT(items_, size_++, item);
+  }
+
+  // classed like evaluate()'s own result, for trim_intermediate_plots()
+  cpp11::sexp take() const {
+    cpp11::sexp out = cpp11::safe[Rf_allocVector](VECSXP, size_);
+    for (R_xlen_t i = 0; i < size_; ++i) {
+      SET_VECTOR_ELT(out, i, VECTOR_ELT(items_, i));
+    }
+    cpp11::writable::strings klass({"evaluate_evaluation", "list"});
+    Rf_setAttrib(out, R_ClassSymbol, klass);
+    return out;
+  }
+
+private:
+  // doubles the capacity, so pushing n items copies O(n) pointers
+  void grow() {
+    R_xlen_t capacity = items_ == R_NilValue ? 64 : 2 * XLENGTH(items_);
+    cpp11::sexp grown = cpp11::safe[Rf_allocVector](VECSXP, capacity);
+    for (R_xlen_t i = 0; i < size_; ++i) {
+      SET_VECTOR_ELT(grown, i, VECTOR_ELT(items_, i));
+    }
+    R_PreserveObject(grown);
+    if (items_ != R_NilValue) {
+      R_ReleaseObject(items_);
+    }
+    items_ = grown;
+  }
+
+  SEXP items_ = R_NilValue;
+  R_xlen_t size_ = 0;
+};
+
+// a streaming evaluation in progress
+struct StreamingOutput {
+  OutputEventSink *sink;
+  PartialOutput partial;
+};
+
+// set for the duration of evaluate::evaluate() of a streaming evaluation so
+// the output handler (.harness_stream_output_handler, defined in RSetup) can
+// get to it. R thread only
+StreamingOutput *active_output = nullptr;
+
+class ActiveOutputGuard {
+public:
+  explicit ActiveOutputGuard(StreamingOutput *output) {
+    active_output = output;
+  }
+  ~ActiveOutputGuard() { active_output = nullptr; }
+};
+
+// one event per element of a character vector, without the newline R ends
+// each piece of output with. same treatment as REvaluator::add_line()
+void emit_lines(OutputEventSink &sink, OutputEventType type, SEXP lines) {
+  if (TYPEOF(lines) != STRSXP) {
+    return;
+  }
+  for (R_xlen_t i = 0; i < XLENGTH(lines); ++i) {
+    SEXP line_sexp = STRING_ELT(lines, i);
+    if (line_sexp == NA_STRING) {
+      continue;
+    }
+    std::string line = char_to_utf8(line_sexp);
+    if (!line.empty() && line.back() == '\n') {
+      line.pop_back();
+    }
+    sink.push_event(OutputEvent{type, std::move(line)});
+  }
+}
+
+// .Call entry point of the streaming output handler, called with every item
+// evaluate() produces and returns it unchanged. keeps the item for an
+// interrupted evaluation and sends it to the sink, except plots, which are
+// only final after trim_intermediate_plots. the event types are worked out
+// here from the item's class, the R side does nothing but the call
+SEXP harness_emit_output(SEXP item) {
+  BEGIN_CPP11
+  if (active_output == nullptr) {
+    return item;
+  }
+  active_output->partial.push(item);
+
+  OutputEventSink &sink = *active_output->sink;
+  std::optional<std::string> message;
+  OutputEventType type = OutputEventType::ERROR;
+  switch (classify_eval_item(item)) {
+  case EvalItemKind::SOURCE:
+    emit_lines(sink, OutputEventType::SOURCE, list_element(item, "src"));
+    break;
+  case EvalItemKind::TEXT:
+    emit_lines(sink, OutputEventType::TEXT, item);
+    break;
+  case EvalItemKind::MESSAGE:
+    type = OutputEventType::MESSAGE;
+    message =
+        condition_message(item, r_eval_handles().base_condition_message);
+    break;
+  case EvalItemKind::WARNING:
+    type = OutputEventType::WARNING;
+    message =
+        condition_message(item, r_eval_handles().base_condition_message);
+    break;
+  case EvalItemKind::ERROR:
+    message =
+        condition_message(item, r_eval_handles().base_condition_message);
+    break;
+  case EvalItemKind::PLOT:
+  case EvalItemKind::OTHER:
+    break;
+  }
+  if (message.has_value()) {
+    if (!message->empty() && message->back() == '\n') {
+      message->pop_back();
+    }
+    sink.push_event(OutputEvent{type, std::move(*message)});
+  }
+  return item;
+  END_CPP11
+}
+
+// recordedplot -> SVG through .harness_render_svg (svglite::svgstring),
+// empty if it gave back something else. R errors come out as
+// cpp11::unwind_exception, the svglite device is closed by then. reloadable
+// is for plots that were serialized in another process, their native symbol
+// pointers did not survive and replayPlot has to look them up again
+std::optional<std::string> render_plot_svg(const REvalHandles &handles,
+                                           SEXP recorded_plot,
+                                           bool reloadable) {
+  cpp11::sexp svg_captured_content = handles.render_svg(
+      recorded_plot,
+      cpp11::named_arg("reloadable") = cpp11::r_bool(reloadable));
+
+  // a char vector returned
+  if (TYPEOF(svg_captured_content) != STRSXP ||
+      XLENGTH(svg_captured_content) == 0) {
+    return std::nullopt;
+  }
+  return char_to_utf8(STRING_ELT(svg_captured_content, 0));
+}
+
+// recordedplot -> PNG bytes, through .harness_render_png (ragg if installed,
+// cairo png otherwise). empty if it didn't give back a raw vector
+std::optional<std::string> render_plot_png(const REvalHandles &handles,
+                                           SEXP recorded_plot,
+                                           bool reloadable) {
+  cpp11::sexp png = handles.render_png(
+      recorded_plot,
+      cpp11::named_arg("reloadable") = cpp11::r_bool(reloadable));
+  if (TYPEOF(png) != RAWSXP || XLENGTH(png) == 0) {
+    return std::nullopt;
+  }
+  return std::string(reinterpret_cast<const char *>(RAW(png)), XLENGTH(png));
+}
+
+// AUTO switches to PNG above these. SVG grows with the number of drawn
+// elements, a scatter plot of a few 100k points is tens of MB of SVG that
+// the client can barely display, while the PNG stays the same size.
+// the serialized recordedplot grows the same way, so a big one goes to PNG
+// without trying SVG first
+constexpr std::size_t auto_png_serialized_bytes = 8 * 1024 * 1024;
+constexpr std::size_t auto_png_svg_bytes = 2 * 1024 * 1024;
+
+// renders recorded_plot as policy says. serialized_size is the size of the
+// serialized recordedplot, 0 if it never was serialized (AUTO then only
+// looks at the SVG)
+std::optional<PlotOutput> render_plot(const REvalHandles &handles,
+                                      SEXP recorded_plot,
+                                      PlotFormatPolicy policy, bool reloadable,
+                                      std::size_t serialized_size) {
+  bool png_first =
+      policy == PlotFormatPolicy::PNG ||
+      (policy == PlotFormatPolicy::AUTO &&
+       serialized_size > auto_png_serialized_bytes);
+
+  if (!png_first) {
+    std::optional<std::string> svg =
+        render_plot_svg(handles, recorded_plot, reloadable);
+    if (policy != PlotFormatPolicy::AUTO || !svg.has_value() ||
+        svg->size() <= auto_png_svg_bytes) {
+      if (!svg.has_value()) {
+        return std::nullopt;
+      }
+      return PlotOutput{PlotFormat::SVG, std::move(*svg)};
+    }
+    // too big to be useful as SVG, replay it once more for the PNG
+  }
+
+  std::optional<std::string> png =
+      render_plot_png(handles, recorded_plot, reloadable);
+  if (!png.has_value()) {
+    return std::nullopt;
+  }
+  return PlotOutput{PlotFormat::PNG, std::move(*png)};
+}
+
+// R_Serialize/R_Unserialize streams over a std::string, so a plot goes
+// straight into the frame payload without an intermediate raw vector
+void append_serialized_byte(R_outpstream_t stream, int c) {
+  static_cast<std::string *>(stream->data)->push_back(static_cast<char>(c));
+}
+
+void append_serialized_bytes(R_outpstream_t stream, void *buf, int length) {
+  static_cast<std::string *>(stream->data)
+      ->append(static_cast<const char *>(buf), static_cast<size_t>(length));
+}
+
+int read_serialized_byte(R_inpstream_t stream) {
+  auto *bytes = static_cast<std::string_view *>(stream->data);
+  if (bytes->empty()) {
+    Rf_error("serialized plot is truncated");
+  }
+  int c = static_cast<unsigned char>(bytes->front());
+  bytes->remove_prefix(1);
+  return c;
+}
+
+void read_serialized_bytes(R_inpstream_t stream, void *buf, int length) {
+  auto *bytes = static_cast<std::string_view *>(stream->data);
+  if (length < 0 || bytes->size() < static_cast<size_t>(length)) {
+    Rf_error("serialized plot is truncated");
+  }
+  std::memcpy(buf, bytes->data(), static_cast<size_t>(length));
+  bytes->remove_prefix(static_cast<size_t>(length));
+}
+
+std::string serialize_recorded_plot(SEXP recorded_plot) {
+  std::string bytes;
+  struct R_outpstream_st stream;
+  R_InitOutPStream(&stream, static_cast<R_pstream_data_t>(&bytes),
+                   R_pstream_binary_format, 3, append_serialized_byte,
+                   append_serialized_bytes, nullptr, R_NilValue);
+  cpp11::unwind_protect([&] { R_Serialize(recorded_plot, &stream); });
+  return bytes;
+}
+
+cpp11::sexp unserialize_recorded_plot(std::string_view serialized_plot) {
+  struct R_inpstream_st stream;
+  R_InitInPStream(&stream, static_cast<R_pstream_data_t>(&serialized_plot),
+                  R_pstream_any_format, read_serialized_byte,
+                  read_serialized_bytes, nullptr, R_NilValue);
+  return cpp11::unwind_protect([&] { return R_Unserialize(&stream); });
+}
+
+// geterrmessage() without the "\n" R ends it with, what R_tryEval left
+// behind after an error
+std::string last_error_message(const REvalHandles &handles) {
+  std::string message = "An R error occurred, but its message could not be "
+                        "retrieved.";
+  try {
+    cpp11::strings r_error_msg_sxp(handles.base_geterrmessage());
+    if (r_error_msg_sxp.size() > 0) {
+      message = cpp11::as_cpp<std::string>(r_error_msg_sxp[0]);
+    }
+  } catch (...) {
+    // Failed to get error message, keep the generic one.
+  }
+  while (!message.empty() && message.back() == '\n') {
+    message.pop_back();
+  }
+  return message;
+}
+
+// one line about a management task's value, built in C instead of
+// print()ing it: scalars by their value, data frames by their dimensions,
+// everything else by its class and length
+std::string value_summary(SEXP value) {
+  if (value == R_NilValue) {
+    return "NULL";
+  }
+
+  SEXP klass = Rf_getAttrib(value, R_ClassSymbol);
+  R_xlen_t length = Rf_xlength(value);
+  if (Rf_inherits(value, "data.frame")) {
+    SEXP row_names = Rf_getAttrib(value, R_RowNamesSymbol);
+    return "data.frame: " + std::to_string(Rf_xlength(row_names)) +
+           " rows x " + std::to_string(length) + " columns";
+  }
+
+  if (klass == R_NilValue && length == 1) {
+    switch (TYPEOF(value)) {
+    case LGLSXP: {
+      int v = LOGICAL(value)[0];
+      return v == NA_LOGICAL ? "NA" : (v ? "TRUE" : "FALSE");
+    }
+    case INTSXP: {
+      int v = INTEGER(value)[0];
+      return v == NA_INTEGER ? "NA" : std::to_string(v);
+    }
+    case REALSXP: {
+      double v = REAL(value)[0];
+      if (ISNA(v)) {
+        return "NA";
+      }
+      char formatted[32];
+      std::snprintf(formatted, sizeof(formatted), "%.15g", v);
+      return formatted;
+    }
+    case STRSXP:
+      return char_to_utf8(STRING_ELT(value, 0));
+    default:
+      break;
+    }
+  }
+
+  std::string type = TYPEOF(klass) == STRSXP && XLENGTH(klass) > 0
+                         ? char_to_utf8(STRING_ELT(klass, 0))
+                         : Rf_type2char(TYPEOF(value));
+  return type + " of length " + std::to_string(length);
+}
+} // namespace
+
 // need to make an R string, call evaluate on it with the proper parameters
 // and then iterate over the evaluate object (either in R or C++) to get
 // out the proper strings and graphics objects.
@@ -25,185 +482,258 @@ namespace RWorker {
 // RResponse at the end of execution
 class REvaluator {
 private:
-  // vectors that will get passed into
-  std::vector<std::string> r_text_output;
-  std::vector<std::string> r_plot_output;
+  // console output, only its head and tail past the task's limits
+  ConsoleOutputBuffer r_text_output;
+  std::vector<PlotOutput> r_plot_output;
+  // what the plots are rendered as, from the task
+  PlotFormatPolicy plot_policy = PlotFormatPolicy::DEFAULT;
   // this will get set to signal the code had an error at some point in
   // execution to allow the agent to retry that specific code instead of
   // increasing context further
   bool eval_error = false;
+  // streaming receiver, null if nobody is listening
+  std::shared_ptr<OutputEventSink> event_sink;
+  // this worker's render helpers, null to render everything inline
+  PlotRenderPool *render_pool = nullptr;
+  // tells whether the task was interrupted, null if it can't be
+  RTaskControl *task_control = nullptr;
+
+  bool interrupted() const {
+    return task_control != nullptr &&
+           task_control->interrupt_reason() != InterruptReason::NONE;
+  }
+
+  // a recordedplot handed to the render helpers. plot stays protected as an
+  // element of the evaluate() result until the plots are collected
+  struct PendingPlot {
+    SEXP plot;
+    // empty if it never made it to the pool
+    std::optional<std::size_t> batch_index;
+  };
+
+  // each piece of output is its own line, without the newline R ends it with
+  void add_line(std::string_view line) {
+    if (!line.empty() && line.back() == '\n') {
+      line.remove_suffix(1);
+    }
+    r_text_output.push_back(line);
+  }
+
+  void emit_event(OutputEventType type, const std::string &content) {
+    if (event_sink) {
+      event_sink->push_event(OutputEvent{type, content});
+    }
+  }
+
+  void add_plot(PlotOutput plot) {
+    r_plot_output.push_back(std::move(plot));
+    // plots are only final after trim_intermediate_plots, so they
+    // are streamed here instead of from the output handler
+    if (event_sink) {
+      OutputEvent event{OutputEventType::PLOT, r_plot_output.back().data};
+      event.plot_format = r_plot_output.back().format;
+      event_sink->push_event(std::move(event));
+    }
+  }
+
+  void render_plot_inline(const REvalHandles &handles, SEXP plot) {
+    try {
+      std::optional<PlotOutput> rendered =
+          render_plot(handles, plot, plot_policy, false, 0);
+      if (rendered.has_value()) {
+        add_plot(std::move(*rendered));
+      } else {
+        add_line("Warning: plot renderer didn't return any SVG or PNG data");
+      }
+    } catch (const cpp11::unwind_exception &e_svg) {
+      eval_error = true;
+      add_line("Error: Failed to render plot.");
+      // Potentially log more details from e_svg if possible, or let outer
+      // handler do it. For now, the R error message from svglite might be
+      // caught by R_ContinueUnwind by the caller
+    } catch (const std::exception &e_svg_cpp) {
+      eval_error = true;
+      add_line(std::string("Error: C++ exception during plot rendering: ") +
+               e_svg_cpp.what());
+    }
+  }
+
+  // waits for the render helpers and adds the plots in their original order.
+  // whatever the helpers could not do is rendered inline
+  void collect_pending_plots(const REvalHandles &handles,
+                             const std::vector<PendingPlot> &pending_plots) {
+    std::vector<std::optional<PlotRenderResult>> rendered =
+        render_pool->collect();
+
+    for (const PendingPlot &pending : pending_plots) {
+      std::optional<PlotRenderResult> result;
+      if (pending.batch_index.has_value() &&
+          pending.batch_index.value() < rendered.size()) {
+        result = std::move(rendered[pending.batch_index.value()]);
+      }
+
+      if (!result.has_value()) {
+        render_plot_inline(handles, pending.plot);
+      } else if (result->ok) {
+        add_plot(PlotOutput{result->format, std::move(result->content)});
+      } else {
+        eval_error = true;
+        add_line("Error: Failed to render plot: " + result->content);
+      }
+    }
+  }
 
 public:
   REvaluator() = default;
+  explicit REvaluator(std::shared_ptr<OutputEventSink> sink,
+                      PlotRenderPool *pool = nullptr,
+                      PlotFormatPolicy policy = PlotFormatPolicy::DEFAULT,
+                      RTaskControl *control = nullptr,
+                      OutputLimits output_limits = {})
+      : r_text_output(output_limits), plot_policy(policy),
+        event_sink(std::move(sink)), render_pool(pool), task_control(control) {
+  }
 
   void process_r_code(const std::string &r_code_snippet) {
     
-    // Get R functions using cpp11::package
-    cpp11::function evaluate_evaluate = cpp11::package("evaluate")["evaluate"];
-    cpp11::function evaluate_trim_plots =
-        cpp11::package("evaluate")["trim_intermediate_plots"];
-    cpp11::function svglite_svgstring_device_setup =
-        cpp11::package("svglite")["svgstring"];
-    cpp11::function base_class_fn = cpp11::package("base")["class"];
-    cpp11::function base_condition_message =
-        cpp11::package("base")["conditionMessage"];
-    cpp11::function base_new_env = cpp11::package("base")["new.env"];
-    cpp11::function base_exists = cpp11::package("base")["exists"];
-    cpp11::function base_get = cpp11::package("base")["get"];
-    cpp11::function base_assign = cpp11::package("base")["assign"];
-
-    // more functions for the graphics part
-    cpp11::function grdevices_replay_plot =
-        cpp11::package("grDevices")["replayPlot"];
-    cpp11::function grdevices_dev_off = cpp11::package("grDevices")["dev.off"];
-    // get/create the client environment.
-    // assumes this cpp11 code is running in the global environment which should
-    // be a given
-
-    cpp11::sexp client_r_env_sexp;
-    cpp11::r_string client_env_name("client_env");
-
-    if (cpp11::as_cpp<bool>(base_exists(
-            client_env_name, cpp11::named_arg("where") = R_GlobalEnv,
-            cpp11::named_arg("inherits") = cpp11::r_bool(false)))) {
-      client_r_env_sexp =
-          base_get(client_env_name, cpp11::named_arg("envir") = R_GlobalEnv,
-                   cpp11::named_arg("inherits") = cpp11::r_bool(false));
-    } else {
-      client_r_env_sexp =
-          base_new_env(cpp11::named_arg("parent") = R_GlobalEnv);
-      base_assign(client_env_name, client_r_env_sexp,
-                  cpp11::named_arg("envir") = R_GlobalEnv);
+    // resolved once per interpreter by init_r_eval_handles()
+    const REvalHandles &handles = r_eval_handles();
+    const cpp11::function &evaluate_evaluate = handles.evaluate_evaluate;
+    const cpp11::function &evaluate_trim_plots = handles.evaluate_trim_plots;
+    const cpp11::function &base_condition_message =
+        handles.base_condition_message;
+    SEXP client_r_env_sexp = handles.client_env;
+
+    // plots go to the render helpers when this worker has any left
+    bool offload_plots =
+        render_pool != nullptr && render_pool->num_helpers() > 0;
+    std::vector<PendingPlot> pending_plots;
+    if (offload_plots) {
+      render_pool->begin_batch();
+    }
+
+    // streaming evaluations hand each piece of output to
+    // harness_emit_output() as evaluate produces it, which also keeps it for
+    // when evaluate() doesn't return. the others run with evaluate's default
+    // handler and nothing extra per item
+    std::optional<StreamingOutput> streaming;
+    if (event_sink) {
+      streaming.emplace(StreamingOutput{event_sink.get(), {}});
     }
 
     try {
-      // Evaluate the R code snippet in a new environment
-      cpp11::sexp eval_results_sexp = evaluate_evaluate(
-          cpp11::r_string(r_code_snippet.c_str()),       // input
-          cpp11::named_arg("envir") = client_r_env_sexp, // envir
-          cpp11::named_arg("new_device") =
-              cpp11::r_bool(true) // new_device (usually default)
-      );
+      cpp11::sexp eval_results_sexp;
+      try {
+        // cancels and timeouts only interrupt evaluate() itself, never the
+        // R calls that collect and render its output below
+        InterruptibleSection interruptible(task_control);
+        if (streaming) {
+          ActiveOutputGuard output_guard(&*streaming);
+          eval_results_sexp = evaluate_evaluate(
+              cpp11::r_string(r_code_snippet.c_str()),
+              cpp11::named_arg("envir") = client_r_env_sexp,
+              cpp11::named_arg("new_device") = cpp11::r_bool(true),
+              cpp11::named_arg("output_handler") =
+                  handles.stream_output_handler);
+        } else {
+          eval_results_sexp = evaluate_evaluate(
+              cpp11::r_string(r_code_snippet.c_str()),
+              cpp11::named_arg("envir") = client_r_env_sexp,
+              cpp11::named_arg("new_device") = cpp11::r_bool(true));
+        }
+      } catch (const cpp11::unwind_exception &) {
+        if (!interrupted()) {
+          throw;
+        }
+        // interrupted, evaluate() never returned. a streaming evaluation has
+        // what it got through, a polled one only gets the interrupt line
+        eval_results_sexp =
+            streaming ? streaming->partial.take() : PartialOutput().take();
+      }
 
       cpp11::sexp trimmed_results_sexp = evaluate_trim_plots(eval_results_sexp);
       cpp11::list r_results(trimmed_results_sexp);
 
       for (cpp11::sexp r_item_sexp : r_results) {
-        if (r_item_sexp == R_NilValue)
-          continue;
-
-        cpp11::sexp class_attr_sexp = base_class_fn(r_item_sexp);
-        if (class_attr_sexp == R_NilValue || TYPEOF(class_attr_sexp) != STRSXP)
-          continue;
-
-        cpp11::strings item_classes(class_attr_sexp);
-        if (item_classes.size() == 0)
-          continue;
-
-        
-        std::string primary_class = static_cast<std::string>(item_classes[0]);
-
-        if (primary_class == "source") {
-          cpp11::list item_as_list(r_item_sexp);
-
+        switch (classify_eval_item(r_item_sexp)) {
+        case EvalItemKind::SOURCE: {
           // Default evaluate source handler creates list(src = value)
           // where value is the source code character vector.
-
-          cpp11::sexp src_val_sexp = item_as_list["src"];
-
-          if (src_val_sexp == R_NilValue) {
-            continue;
-          }
+          SEXP src_val_sexp = list_element(r_item_sexp, "src");
           if (TYPEOF(src_val_sexp) == STRSXP) {
-            cpp11::strings src_lines(src_val_sexp);
-            for (const cpp11::r_string &line : src_lines) {
-              r_text_output.push_back("> " + static_cast<std::string>(line));
+            for (R_xlen_t i = 0; i < XLENGTH(src_val_sexp); ++i) {
+              add_line("> " + char_to_utf8(STRING_ELT(src_val_sexp, i)));
             }
           }
-        } else if (primary_class ==
-                   "character") { // Plain text output from print(), cat()
-          cpp11::strings lines(r_item_sexp);
-          for (const cpp11::r_string &line : lines) {
-            r_text_output.push_back(static_cast<std::string>(line));
-          }
-        } else if (primary_class == "recordedplot") {
-          try {
-            // need to call svgstring() first to setup the device
-            // also able to set the svgstring parameters here, like width/height
-            cpp11::sexp svgstring_capture = svglite_svgstring_device_setup();
-            cpp11::function svg_capture_func(svgstring_capture);
-
-            // replay the plot
-            grdevices_replay_plot(r_item_sexp);
-
-            // call the capture function
-            cpp11::sexp svg_captured_content = svg_capture_func();
-
-            // close device
-            grdevices_dev_off();
-
-            // a char vector returned
-            if (TYPEOF(svg_captured_content) == STRSXP &&
-                cpp11::strings(svg_captured_content).size() > 0) {
-              cpp11::strings svg_r_string(svg_captured_content);
-              r_plot_output.push_back(
-                  static_cast<std::string>(svg_r_string[0]));
+          break;
+        }
+        case EvalItemKind::TEXT: {
+          // Plain text output from print(), cat()
+          for (R_xlen_t i = 0; i < XLENGTH(r_item_sexp); ++i) {
+            SEXP line_sexp = STRING_ELT(r_item_sexp, i);
+            if (line_sexp != NA_STRING && Rf_charIsUTF8(line_sexp)) {
+              // straight from the CHARSXP, most of a huge line may be
+              // dropped and is never copied then
+              add_line(std::string_view(CHAR(line_sexp), LENGTH(line_sexp)));
             } else {
-              r_text_output.push_back("Warning: svglite::svgstring capturer "
-                                      "function didn't return a STRSXP");
+              add_line(char_to_utf8(line_sexp));
             }
-          } catch (const cpp11::unwind_exception &e_svg) {
-            eval_error = true;
-            r_text_output.push_back(
-                "Error: Failed to convert plot to SVG with svglite.");
-            // Potentially log more details from e_svg if possible, or let outer
-            // handler do it. For now, the R error message from svglite might be
-            // caught by R_ContinueUnwind by the caller
-          } catch (const std::exception &e_svg_cpp) {
-            eval_error = true;
-            r_text_output.push_back(
-                std::string("Error: C++ exception during SVG conversion: ") +
-                e_svg_cpp.what());
           }
-        } else if (primary_class == "error" || primary_class == "simpleError" || 
-                   item_classes.contains(cpp11::r_string("error"))) {
-          eval_error = true;
-          cpp11::sexp error_msg_sexp = base_condition_message(r_item_sexp);
-          if (TYPEOF(error_msg_sexp) == STRSXP &&
-              cpp11::strings(error_msg_sexp).size() > 0) {
-            cpp11::strings error_message_r(error_msg_sexp);
-            r_text_output.push_back(
-                "Error: " + static_cast<std::string>(error_message_r[0]));
-          } else {
-            r_text_output.push_back("Error: An R error occurred, but its "
-                                    "message could not be retrieved.");
-          }
-        } else if (primary_class == "warning" || primary_class == "simpleWarning" ||
-                   item_classes.contains(cpp11::r_string("warning"))) {
-          cpp11::sexp warning_msg_sexp = base_condition_message(r_item_sexp);
-          if (TYPEOF(warning_msg_sexp) == STRSXP &&
-              cpp11::strings(warning_msg_sexp).size() > 0) {
-            cpp11::strings warning_message_r(warning_msg_sexp);
-            r_text_output.push_back(
-                "Warning: " + static_cast<std::string>(warning_message_r[0]));
-          } else {
-            r_text_output.push_back("Warning: An R warning occurred, but its "
-                                    "message could not be retrieved.");
+          break;
+        }
+        case EvalItemKind::PLOT: {
+          if (!offload_plots) {
+            render_plot_inline(handles, r_item_sexp);
+            break;
           }
-        } else if (primary_class == "message" || primary_class == "simpleMessage" || 
-                   item_classes.contains(cpp11::r_string("message"))) {
-          cpp11::sexp message_msg_sexp = base_condition_message(r_item_sexp);
-          if (TYPEOF(message_msg_sexp) == STRSXP &&
-              cpp11::strings(message_msg_sexp).size() > 0) {
-            cpp11::strings message_r(message_msg_sexp);
-            r_text_output.push_back(static_cast<std::string>(message_r[0]));
-          } else {
-            r_text_output.push_back("Message: An R message occurred, but its "
-                                    "content could not be retrieved.");
+          // rendered by the render helpers while the rest of the results
+          // are processed, collected in order after the loop
+          PendingPlot pending{r_item_sexp, std::nullopt};
+          try {
+            pending.batch_index =
+                render_pool->submit(serialize_recorded_plot(r_item_sexp),
+                                    plot_policy);
+          } catch (const std::exception &) {
+            // could not serialize it, rendered inline when collected
           }
+          pending_plots.push_back(pending);
+          break;
+        }
+        case EvalItemKind::ERROR: {
+          eval_error = true;
+          std::optional<std::string> message =
+              condition_message(r_item_sexp, base_condition_message);
+          add_line(message ? "Error: " + *message
+                           : "Error: An R error occurred, but its "
+                             "message could not be retrieved.");
+          break;
+        }
+        case EvalItemKind::WARNING: {
+          std::optional<std::string> message =
+              condition_message(r_item_sexp, base_condition_message);
+          add_line(message ? "Warning: " + *message
+                           : "Warning: An R warning occurred, but its "
+                             "message could not be retrieved.");
+          break;
+        }
+        case EvalItemKind::MESSAGE: {
+          std::optional<std::string> message =
+              condition_message(r_item_sexp, base_condition_message);
+          add_line(message ? *message
+                           : "Message: An R message occurred, but its "
+                             "content could not be retrieved.");
+          break;
+        }
+        case EvalItemKind::OTHER:
+          // Other types like "evaluate_restarting" can be ignored for output
+          // capture.
+          break;
         }
-        // Other types like "evaluate_restarting" can be ignored for output
-        // capture.
+      }
+
+      // the response is done once the last plot is
+      if (offload_plots) {
+        collect_pending_plots(handles, pending_plots);
       }
     
     } catch (const cpp11::unwind_exception &e) {
@@ -213,15 +743,11 @@ public:
       // by R's top-level error handler when R_ContinueUnwind is called by the
       // wrapper of this C++ code. We can try to get the last R error message to
       // include it in our text output.
-      r_text_output.push_back(
-          "Error: R API call failed (cpp11::unwind_exception).");
+      add_line("Error: R API call failed (cpp11::unwind_exception).");
       try {
-        cpp11::function get_r_error_message =
-            cpp11::package("base")["geterrmessage"];
-        cpp11::strings r_error_msg_sxp(get_r_error_message());
+        cpp11::strings r_error_msg_sxp(handles.base_geterrmessage());
         if (r_error_msg_sxp.size() > 0) {
-          r_text_output.push_back(
-              cpp11::as_cpp<std::string>(r_error_msg_sxp[0]));
+          add_line(cpp11::as_cpp<std::string>(r_error_msg_sxp[0]));
         }
       } catch (...) {
         // Failed to get error message, do nothing extra.
@@ -231,40 +757,50 @@ public:
       // outputs and set eval_error.
     } catch (const std::exception &e) {
       eval_error = true;
-      r_text_output.push_back(
-          std::string("Error: C++ exception during R processing: ") + e.what());
+      add_line(std::string("Error: C++ exception during R processing: ") +
+               e.what());
     }
   }
 
-  // we want each section to be its own line so we strip the extra newline
-  // after each line in the r_text_output vector
-  void strip_trailing_newline() {
-    for(std::string& line : r_text_output) {
-      if (!line.empty() && line[line.length()-1] == '\n') {
-        line.erase(line.length() - 1);
-      }
+  // moves the collected output into the response, call once at the end
+  RResponse build_response(std::string task_uuid) {
+    InterruptReason interrupt_reason = task_control != nullptr
+                                           ? task_control->interrupt_reason()
+                                           : InterruptReason::NONE;
+    if (interrupt_reason == InterruptReason::CANCELLED) {
+      add_line("Cancelled: the evaluation was interrupted");
+    } else if (interrupt_reason == InterruptReason::TIMED_OUT) {
+      add_line("Timed out: the evaluation ran longer than its time limit");
     }
-  }
 
-  RResponse build_response(const std::string &task_uuid) const {
     RClientOutputPayload payload;
-    payload.console_output = r_text_output;
-    payload.graphic_output = r_plot_output;
+    payload.console_output = r_text_output.take_lines();
+    payload.console_sizes = r_text_output.sizes();
+    payload.graphic_output = std::move(r_plot_output);
+    payload.plot_policy = plot_policy;
 
     ResponseStatus status = eval_error ? ResponseStatus::FAILURE_R_SCRIPT_ERROR
                                        : ResponseStatus::SUCCESS;
+    if (interrupt_reason == InterruptReason::CANCELLED) {
+      status = ResponseStatus::CANCELLED;
+    } else if (interrupt_reason == InterruptReason::TIMED_OUT) {
+      status = ResponseStatus::FAILURE_TIMEOUT;
+    }
 
     // The error message for R script errors is part of the console_output.
     // The RResponse's optional error_message is more for C++ or task-level
     // errors outside R.
-    return RResponse(task_uuid, status, payload);
+    return RResponse(std::move(task_uuid), status, std::move(payload));
   }
 
   bool has_error() const { return eval_error; }
 };
 
-std::unique_ptr<RResponse> eval_client_R(std::string code,
-                                         std::string task_uuid) {
+std::unique_ptr<RResponse>
+eval_client_R(std::string code, std::string task_uuid,
+              std::shared_ptr<OutputEventSink> event_sink,
+              PlotRenderPool *render_pool, PlotFormatPolicy plot_policy,
+              RTaskControl *task_control, OutputLimits output_limits) {
   // debug print
   #ifndef NDEBUG
   std::cout << "eval_client_R: " << __FILE__ << '\n'
@@ -272,16 +808,172 @@ std::unique_ptr<RResponse> eval_client_R(std::string code,
             << std::flush;
   #endif
 
-  REvaluator evaluator;
+  REvaluator evaluator(std::move(event_sink), render_pool, plot_policy,
+                       task_control, output_limits);
 
   // call on the code
   evaluator.process_r_code(code);
 
-  // strip trailing newline
-  evaluator.strip_trailing_newline();
-
   // get the RResponse back and set the task_uuid &&&&& make a unique ptr!! :)
-  return std::make_unique<RResponse>(evaluator.build_response(task_uuid));
+  return std::make_unique<RResponse>(
+      evaluator.build_response(std::move(task_uuid)));
+}
+
+std::unique_ptr<RResponse> eval_management_R(const std::string &code,
+                                             std::string task_uuid,
+                                             RTaskControl *task_control) {
+  const REvalHandles &handles = r_eval_handles();
+
+  ParseStatus parse_status = PARSE_NULL;
+  cpp11::sexp exprs;
+  try {
+    cpp11::sexp code_sexp = cpp11::as_sexp(code.c_str());
+    exprs = cpp11::safe[R_ParseVector](code_sexp, -1, &parse_status,
+                                       R_NilValue);
+  } catch (const cpp11::unwind_exception &) {
+    return std::make_unique<RResponse>(
+        std::move(task_uuid), ResponseStatus::FAILURE_R_SCRIPT_ERROR,
+        ManagementTaskResultPayload{}, last_error_message(handles));
+  }
+
+  if (parse_status != PARSE_OK) {
+    std::string message = "incomplete R code";
+    if (parse_status == PARSE_ERROR) {
+      // R_ParseVector keeps the details to itself, parse() again the
+      // usual way for its message. only on this path, it's rare
+      int parse_failed = 0;
+      cpp11::sexp parse_call = cpp11::safe[Rf_lang2](
+          Rf_install("parse"), cpp11::as_sexp(code.c_str()));
+      SET_TAG(CDR(parse_call), Rf_install("text"));
+      R_tryEval(parse_call, R_BaseEnv, &parse_failed);
+      message = parse_failed ? last_error_message(handles) : "syntax error";
+    }
+    return std::make_unique<RResponse>(
+        std::move(task_uuid), ResponseStatus::FAILURE_R_SCRIPT_ERROR,
+        ManagementTaskResultPayload{}, std::move(message));
+  }
+
+  // each expression in client_env like the console would, the value of the
+  // last one is what gets summarized
+  cpp11::sexp value = R_NilValue;
+  for (R_xlen_t i = 0; i < XLENGTH(exprs); ++i) {
+    int eval_failed = 0;
+    SEXP result;
+    {
+      InterruptibleSection interruptible(task_control);
+      result = R_tryEval(VECTOR_ELT(exprs, i), handles.client_env,
+                         &eval_failed);
+    }
+    if (eval_failed) {
+      InterruptReason interrupt_reason =
+          task_control != nullptr ? task_control->interrupt_reason()
+                                  : InterruptReason::NONE;
+      if (interrupt_reason == InterruptReason::CANCELLED) {
+        return std::make_unique<RResponse>(
+            std::move(task_uuid), ResponseStatus::CANCELLED,
+            ManagementTaskResultPayload{},
+            "Cancelled: the evaluation was interrupted");
+      }
+      if (interrupt_reason == InterruptReason::TIMED_OUT) {
+        return std::make_unique<RResponse>(
+            std::move(task_uuid), ResponseStatus::FAILURE_TIMEOUT,
+            ManagementTaskResultPayload{},
+            "Timed out: the evaluation ran longer than its time limit");
+      }
+      return std::make_unique<RResponse>(
+          std::move(task_uuid), ResponseStatus::FAILURE_R_SCRIPT_ERROR,
+          ManagementTaskResultPayload{}, last_error_message(handles));
+    }
+    value = result;
+  }
+
+  std::string summary;
+  try {
+    summary = value_summary(value);
+  } catch (const cpp11::unwind_exception &) {
+    // only the UTF-8 translation calls into R
+    summary = "value could not be summarized";
+  }
+  return std::make_unique<RResponse>(std::move(task_uuid),
+                                     ResponseStatus::SUCCESS,
+                                     ManagementTaskResultPayload{summary});
+}
+
+PlotOutput render_serialized_plot(std::string_view serialized_plot,
+                                  PlotFormatPolicy policy) {
+  const REvalHandles &handles = r_eval_handles();
+  std::optional<PlotOutput> plot;
+  try {
+    cpp11::sexp recorded_plot = unserialize_recorded_plot(serialized_plot);
+    plot = render_plot(handles, recorded_plot, policy, true,
+                       serialized_plot.size());
+  } catch (const cpp11::unwind_exception &) {
+    std::string message = "R error while rendering";
+    try {
+      cpp11::strings r_error_msg_sxp(handles.base_geterrmessage());
+      if (r_error_msg_sxp.size() > 0) {
+        message = cpp11::as_cpp<std::string>(r_error_msg_sxp[0]);
+      }
+    } catch (...) {
+      // Failed to get error message, keep the generic one.
+    }
+    throw std::runtime_error(message);
+  }
+
+  if (!plot.has_value()) {
+    throw std::runtime_error("plot renderer didn't return any SVG or PNG data");
+  }
+  return std::move(*plot);
+}
+
+void init_r_eval_handles() {
+  if (eval_handles != nullptr) {
+    return;
+  }
+
+  cpp11::function base_exists = cpp11::package("base")["exists"];
+  cpp11::function base_get = cpp11::package("base")["get"];
+  cpp11::function base_assign = cpp11::package("base")["assign"];
+  cpp11::function base_new_env = cpp11::package("base")["new.env"];
+
+  // get/create the client environment. kept as a binding in the global env
+  // too, so it is visible the same way it was before the cache
+  cpp11::sexp client_r_env_sexp;
+  cpp11::r_string client_env_name("client_env");
+  if (cpp11::as_cpp<bool>(base_exists(
+          client_env_name, cpp11::named_arg("where") = R_GlobalEnv,
+          cpp11::named_arg("inherits") = cpp11::r_bool(false)))) {
+    client_r_env_sexp =
+        base_get(client_env_name, cpp11::named_arg("envir") = R_GlobalEnv,
+                 cpp11::named_arg("inherits") = cpp11::r_bool(false));
+  } else {
+    client_r_env_sexp = base_new_env(cpp11::named_arg("parent") = R_GlobalEnv);
+    base_assign(client_env_name, client_r_env_sexp,
+                cpp11::named_arg("envir") = R_GlobalEnv);
+  }
+
+  eval_handles = new REvalHandles{
+      cpp11::package("evaluate")["evaluate"],
+      cpp11::package("evaluate")["trim_intermediate_plots"],
+      cpp11::package("base")["conditionMessage"],
+      cpp11::package("base")["geterrmessage"],
+      cpp11::function(cpp11::safe[Rf_findVarInFrame](
+          R_GlobalEnv, Rf_install(".harness_render_svg"))),
+      cpp11::function(cpp11::safe[Rf_findVarInFrame](
+          R_GlobalEnv, Rf_install(".harness_render_png"))),
+      cpp11::safe[Rf_findVarInFrame](
+          R_GlobalEnv, Rf_install(".harness_stream_output_handler")),
+      client_r_env_sexp,
+  };
+}
+
+void register_r_eval_routines() {
+  static const R_CallMethodDef call_methods[] = {
+      {"harness_emit_output", (DL_FUNC)&harness_emit_output, 1},
+      {NULL, NULL, 0}};
+
+  // routines registered on the embedding "DLL" are found by .Call("name")
+  R_registerRoutines(R_getEmbeddingDllInfo(), NULL, call_methods, NULL, NULL);
 }
 
 } // namespace RWorker
@@ -1,7 +1,49 @@
+#pragma once
+
 #include "r_result.h"
 #include <memory>
+#include <string>
+#include <string_view>
 
 namespace RWorker {
-std::unique_ptr<RResponse> eval_client_R(std::string code,
-                                         std::string task_uuid);
+class PlotRenderPool;
+class RTaskControl;
+
+// evaluates client code in client_env. if event_sink is set, output is also
+// pushed to it as it is produced. plots are rendered as plot_policy says, by
+// render_pool's helpers if there is one, inline otherwise. if task_control
+// interrupts the evaluation, the output up to there comes back with status
+// CANCELLED or FAILURE_TIMEOUT. console output past output_limits is cut
+// down to its head and tail
+std::unique_ptr<RResponse>
+eval_client_R(std::string code, std::string task_uuid,
+              std::shared_ptr<OutputEventSink> event_sink = nullptr,
+              PlotRenderPool *render_pool = nullptr,
+              PlotFormatPolicy plot_policy = PlotFormatPolicy::DEFAULT,
+              RTaskControl *task_control = nullptr,
+              OutputLimits output_limits = {});
+
+// evaluates management code in client_env without evaluate::evaluate(),
+// graphics devices or output capture: R_ParseVector, then R_tryEval per
+// expression. a success has a one line summary of the last value, a failure
+// R's error message. interrupted by task_control the same way as
+// eval_client_R
+std::unique_ptr<RResponse>
+eval_management_R(const std::string &code, std::string task_uuid,
+                  RTaskControl *task_control = nullptr);
+
+// render helper side of PlotRenderPool: recordedplot serialized by a worker
+// -> SVG or PNG, as policy says. throws std::runtime_error with R's error
+// message on failure
+PlotOutput render_serialized_plot(std::string_view serialized_plot,
+                                  PlotFormatPolicy policy);
+
+// registers the native routines the R side output handlers call back into,
+// needs R initialized. called from exec_R_setup()
+void register_r_eval_routines();
+
+// resolves and preserves the R functions and the client_env used by every
+// evaluation. needs the RSetup snippets to have run (evaluate, svglite and
+// the output handler), called at the end of exec_R_setup()
+void init_r_eval_handles();
 }
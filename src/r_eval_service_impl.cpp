@@ -1,9 +1,33 @@
 #include "r_eval_service_impl.h"
+#include "payload_compression.h"
+#include "plot_store.h"
 #include "r_result.h"
 #include "reval_service.pb.h"
 #include <absl/log/log.h>
+#include <google/protobuf/util/time_util.h>
+#include <algorithm>
+#include <charconv>
+#include <chrono>
+#include <deque>
+#include <functional>
 #include <grpcpp/support/status.h>
+#include <mutex>
+#include <optional>
+#include <string_view>
 #include <thread>
+#include <variant>
+
+// upper bound on how long the response thread blocks before re-checking its
+// stop token, responses themselves wake it immediately
+constexpr std::chrono::milliseconds response_wait_timeout(100);
+
+// GetEvalOperation responses from this size on are sent with gRPC message
+// compression, if the client supports any
+constexpr std::size_t grpc_compression_min_bytes = 64 * 1024;
+
+// most snippets one EvalRScriptBatch may have, the default client queue
+// depth
+constexpr std::size_t max_batch_snippets = 256;
 
 // the constructor just sets in the initializer list
 
@@ -14,7 +38,8 @@
 
 // the getevaloperation should just lookup the eval and send it back
 
-// the cancel should be a no-op for now
+// the cancel forwards to the task's worker, which skips the task if it is
+// still queued and interrupts R if it is running (r_task_control.h)
 
 // therefore we also need a thread whos only job is to handle grabbing
 // responses off the response queue and modifying the EvalOperationStore
@@ -25,8 +50,823 @@
 //
 // MEMBER VARIABLES:
 // EvalOperationStore& operation_store_; -- Contains the thread-safe map UUID ->
-// EvalOperation protobuf moodycamel::ConcurrentQueue<RWorker::RTask>&
-// task_queue_; -- Send tasks to R thread
+// EvalOperation protobuf
+// RWorker::RWorkerPool& worker_pool_; -- Send tasks to the R worker processes
+
+namespace {
+
+EvalStreamEventType to_stream_event_type(RWorker::OutputEventType type) {
+  switch (type) {
+  case RWorker::OutputEventType::SOURCE:
+    return STREAM_EVENT_SOURCE;
+  case RWorker::OutputEventType::TEXT:
+    return STREAM_EVENT_OUTPUT;
+  case RWorker::OutputEventType::MESSAGE:
+    return STREAM_EVENT_MESSAGE;
+  case RWorker::OutputEventType::WARNING:
+    return STREAM_EVENT_WARNING;
+  case RWorker::OutputEventType::ERROR:
+    return STREAM_EVENT_ERROR;
+  case RWorker::OutputEventType::PLOT:
+    return STREAM_EVENT_SVG_PLOT;
+  case RWorker::OutputEventType::DONE:
+    return STREAM_EVENT_DONE;
+  default:
+    return STREAM_EVENT_UNSPECIFIED;
+  }
+}
+
+RWorker::PlotFormatPolicy to_plot_format_policy(PlotFormat format) {
+  switch (format) {
+  case PLOT_FORMAT_SVG:
+    return RWorker::PlotFormatPolicy::SVG;
+  case PLOT_FORMAT_PNG:
+    return RWorker::PlotFormatPolicy::PNG;
+  case PLOT_FORMAT_AUTO:
+    return RWorker::PlotFormatPolicy::AUTO;
+  default:
+    return RWorker::PlotFormatPolicy::DEFAULT;
+  }
+}
+
+PlotFormat to_requested_plot_format(RWorker::PlotFormatPolicy policy) {
+  switch (policy) {
+  case RWorker::PlotFormatPolicy::SVG:
+    return PLOT_FORMAT_SVG;
+  case RWorker::PlotFormatPolicy::PNG:
+    return PLOT_FORMAT_PNG;
+  case RWorker::PlotFormatPolicy::AUTO:
+    return PLOT_FORMAT_AUTO;
+  default:
+    return PLOT_FORMAT_UNSPECIFIED;
+  }
+}
+
+PlotFormat to_plot_format(RWorker::PlotFormat format) {
+  return format == RWorker::PlotFormat::PNG ? PLOT_FORMAT_PNG
+                                            : PLOT_FORMAT_SVG;
+}
+
+// GetEvalOperationRequest and GetPlotRequest, anything with accept_encodings
+template <typename Request>
+bool accepts_encoding(const Request &request, ContentEncoding encoding) {
+  if (encoding == CONTENT_ENCODING_IDENTITY) {
+    return true;
+  }
+  for (int accepted : request.accept_encodings()) {
+    if (accepted == encoding) {
+      return true;
+    }
+  }
+  return false;
+}
+
+EvalStatus to_eval_status(RWorker::ResponseStatus status) {
+  switch (status) {
+  case RWorker::ResponseStatus::SUCCESS:
+    return EVAL_SUCCESS;
+  case RWorker::ResponseStatus::FAILURE_R_SCRIPT_ERROR:
+    return EVAL_R_CODE_ERROR;
+  case RWorker::ResponseStatus::CANCELLED:
+    return EVAL_CANCELLED;
+  case RWorker::ResponseStatus::FAILURE_TIMEOUT:
+    return EVAL_TIMEOUT;
+  case RWorker::ResponseStatus::EXPIRED:
+    return EVAL_EXPIRED;
+  case RWorker::ResponseStatus::SKIPPED:
+    return EVAL_SKIPPED;
+  default:
+    return EVAL_CPP_ERROR;
+  }
+}
+
+void set_console_output_stats(ConsoleOutputStats &stats,
+                              const RWorker::ConsoleOutputSizes &sizes) {
+  stats.set_total_lines(sizes.total_lines);
+  stats.set_total_bytes(sizes.total_bytes);
+  stats.set_retained_lines(sizes.retained_lines);
+  stats.set_retained_bytes(sizes.retained_bytes);
+  stats.set_truncated(sizes.truncated);
+}
+
+// the class a request asked for, if any. unspecified keeps the default of
+// the task's type
+void apply_task_class(RWorker::RTask &task, TaskClass task_class) {
+  switch (task_class) {
+  case TASK_CLASS_CONTROL:
+    task.set_task_class(RWorker::TaskClass::CONTROL);
+    break;
+  case TASK_CLASS_INTERACTIVE:
+    task.set_task_class(RWorker::TaskClass::INTERACTIVE);
+    break;
+  case TASK_CLASS_CLIENT:
+    task.set_task_class(RWorker::TaskClass::CLIENT);
+    break;
+  default:
+    break;
+  }
+}
+
+// metadata a client identifies itself with, for fair scheduling between
+// clients. tasks of a client without an id are scheduled as their session's,
+// or as their connection's (the peer address) if they have no session
+// either
+constexpr char client_id_metadata[] = "x-harness-client-id";
+// tasks per turn, 1 to max_client_weight
+constexpr char client_weight_metadata[] = "x-harness-client-weight";
+constexpr uint32_t max_client_weight = 100;
+
+// who the task is from, set after its session
+void apply_client_identity(RWorker::RTask &task,
+                           const grpc::CallbackServerContext &context) {
+  const auto &metadata = context.client_metadata();
+
+  std::string client_id;
+  auto id_it = metadata.find(client_id_metadata);
+  if (id_it != metadata.end() && id_it->second.size() > 0) {
+    client_id.assign(id_it->second.data(), id_it->second.size());
+  } else if (!task.get_session_id().empty()) {
+    client_id = "session:" + task.get_session_id();
+  } else {
+    std::string peer = context.peer();
+    // no peer to go by, the task gets a queue of its own
+    client_id = peer.empty() ? "task:" + task.get_uuid() : "peer:" + peer;
+  }
+
+  uint32_t weight = 1;
+  auto weight_it = metadata.find(client_weight_metadata);
+  if (weight_it != metadata.end()) {
+    std::string_view value(weight_it->second.data(), weight_it->second.size());
+    uint32_t parsed = 0;
+    auto [end, error] =
+        std::from_chars(value.data(), value.data() + value.size(), parsed);
+    if (error == std::errc() && end == value.data() + value.size()) {
+      weight = std::clamp<uint32_t>(parsed, 1, max_client_weight);
+    }
+  }
+  task.set_client(std::move(client_id), weight);
+}
+
+TaskClass to_task_class_proto(RWorker::TaskClass task_class) {
+  switch (task_class) {
+  case RWorker::TaskClass::CONTROL:
+    return TASK_CLASS_CONTROL;
+  case RWorker::TaskClass::INTERACTIVE:
+    return TASK_CLASS_INTERACTIVE;
+  case RWorker::TaskClass::CLIENT:
+  default:
+    return TASK_CLASS_CLIENT;
+  }
+}
+
+// replaces result's plot_refs by the plots themselves, in svg_plots if the
+// request had no plot format and in plots otherwise. false if a plot is no
+// longer stored (the operation was evicted meanwhile)
+bool inline_plots(EvalResult &result, const PlotStore &plot_store) {
+  bool legacy = result.requested_plot_format() == PLOT_FORMAT_UNSPECIFIED;
+  for (const PlotRef &ref : result.plot_refs()) {
+    std::shared_ptr<const StoredPlot> plot = plot_store.getPlot(ref.id());
+    if (plot == nullptr) {
+      return false;
+    }
+    if (legacy) {
+      result.add_svg_plots(decoded_plot_data(*plot));
+    } else {
+      EvalPlot *eval_plot = result.add_plots();
+      eval_plot->set_format(ref.format());
+      eval_plot->set_data(decoded_plot_data(*plot));
+    }
+  }
+  result.clear_plot_refs();
+  return true;
+}
+
+// the gRPC deadline of the call on the steady clock the workers check it
+// with, none if the client didn't set one
+std::optional<std::chrono::steady_clock::time_point>
+client_deadline(const grpc::CallbackServerContext &context) {
+  std::chrono::system_clock::time_point deadline = context.deadline();
+  if (deadline == std::chrono::system_clock::time_point::max()) {
+    return std::nullopt;
+  }
+  return std::chrono::steady_clock::now() +
+         std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+             deadline - std::chrono::system_clock::now());
+}
+
+// chunks of a GetPlot stream
+constexpr std::size_t plot_chunk_bytes = 1024 * 1024;
+
+// writes one plot in plot_chunk_bytes chunks, one write at a time, and
+// deletes itself when the call is done. data stays alive with the reactor,
+// even if the plot is released from the store meanwhile
+class PlotChunkReactor : public grpc::ServerWriteReactor<PlotChunk> {
+public:
+  PlotChunkReactor(PlotRef ref, ContentEncoding encoding,
+                   std::shared_ptr<const std::string> data)
+      : data_(std::move(data)) {
+    *chunk_.mutable_ref() = std::move(ref);
+    chunk_.set_encoding(encoding);
+    WriteNextChunk();
+  }
+
+  // finishes right away with error
+  explicit PlotChunkReactor(grpc::Status error) { Finish(std::move(error)); }
+
+  void OnWriteDone(bool ok) override {
+    if (!ok) {
+      Finish(grpc::Status(grpc::StatusCode::CANCELLED, "Stream cancelled"));
+      return;
+    }
+    chunk_.Clear();
+    WriteNextChunk();
+  }
+
+  void OnDone() override { delete this; }
+
+private:
+  void WriteNextChunk() {
+    // the first chunk goes out even for an empty plot, it carries the ref
+    if (first_chunk_written_ && offset_ >= data_->size()) {
+      Finish(grpc::Status::OK);
+      return;
+    }
+    std::size_t size = std::min(plot_chunk_bytes, data_->size() - offset_);
+    chunk_.set_data(data_->data() + offset_, size);
+    offset_ += size;
+    first_chunk_written_ = true;
+    StartWrite(&chunk_);
+  }
+
+  std::shared_ptr<const std::string> data_;
+  std::size_t offset_ = 0;
+  bool first_chunk_written_ = false;
+  // the chunk being written, must stay alive until OnWriteDone
+  PlotChunk chunk_;
+};
+
+class EvalStreamSink;
+
+// most a stream queues for a slow client, events past it are dropped
+constexpr std::size_t stream_pending_max_bytes = 16 * 1024 * 1024;
+
+// reactor for EvalRScriptStream. events are pushed from the R worker thread
+// (through EvalStreamSink) and written one at a time, gRPC only allows a
+// single outstanding write. the stream is finished after the DONE event is
+// written, or right away if the client cancels. a cancel (or the deadline
+// running out) also tells the worker, so a task still queued is dropped.
+//
+// the worker doesn't wait for the client, so what the client hasn't read yet
+// is capped at stream_pending_max_bytes. events that don't fit are dropped
+// and a STREAM_EVENT_TRUNCATED event takes their place once there is room
+// again (or before DONE, which is never dropped)
+//
+// StartWrite/Finish are always called without holding mutex_ in case gRPC
+// decides to run a reaction inline
+class EvalStreamReactor : public grpc::ServerWriteReactor<EvalStreamEvent> {
+public:
+  explicit EvalStreamReactor(std::string name) : name_(std::move(name)) {}
+
+  // finishes right away with error, before there is a task
+  explicit EvalStreamReactor(grpc::Status error) { Finish(std::move(error)); }
+
+  void Push(RWorker::OutputEvent event) {
+    EvalStreamEvent message;
+    message.set_name(name_);
+    message.set_type(to_stream_event_type(event.type));
+    if (event.type == RWorker::OutputEventType::PLOT &&
+        event.plot_format == RWorker::PlotFormat::PNG) {
+      // not UTF-8, has to go in the bytes field
+      message.set_type(STREAM_EVENT_PNG_PLOT);
+      message.set_data(std::move(event.content));
+    } else {
+      message.set_content(std::move(event.content));
+    }
+    if (event.type == RWorker::OutputEventType::DONE) {
+      message.set_status(to_eval_status(event.status));
+    }
+
+    std::size_t message_bytes = event_bytes(message);
+
+    std::unique_lock<std::mutex> lock(mutex_);
+    if (cancelled_ || finish_called_) {
+      return;
+    }
+    if (event.type == RWorker::OutputEventType::DONE) {
+      done_queued_ = true;
+    } else if (pending_bytes_ + message_bytes > stream_pending_max_bytes) {
+      ++num_dropped_;
+      return;
+    }
+    if (num_dropped_ > 0) {
+      EvalStreamEvent marker;
+      marker.set_name(name_);
+      marker.set_type(STREAM_EVENT_TRUNCATED);
+      marker.set_content(std::to_string(num_dropped_) +
+                         " events dropped, the client fell behind");
+      pending_bytes_ += event_bytes(marker);
+      pending_.push_back(std::move(marker));
+      num_dropped_ = 0;
+    }
+    pending_bytes_ += message_bytes;
+    pending_.push_back(std::move(message));
+    WriteNextOrFinish(lock);
+  }
+
+  void OnWriteDone(bool ok) override {
+    std::unique_lock<std::mutex> lock(mutex_);
+    write_in_flight_ = false;
+    if (!ok) {
+      cancelled_ = true;
+    }
+    if (cancelled_) {
+      FinishCancelled(lock);
+      return;
+    }
+    WriteNextOrFinish(lock);
+  }
+
+  void OnCancel() override {
+    if (on_cancel_) {
+      on_cancel_();
+    }
+
+    std::unique_lock<std::mutex> lock(mutex_);
+    cancelled_ = true;
+    // with a write in flight OnWriteDone will finish the stream instead
+    if (!write_in_flight_) {
+      FinishCancelled(lock);
+    }
+  }
+
+  void OnDone() override;
+
+  // set once by the handler before any event can arrive
+  void SetSink(std::shared_ptr<EvalStreamSink> sink) {
+    sink_ = std::move(sink);
+  }
+  // same, called (once) when the client cancels
+  void SetOnCancel(std::function<void()> on_cancel) {
+    on_cancel_ = std::move(on_cancel);
+  }
+
+private:
+  static std::size_t event_bytes(const EvalStreamEvent &event) {
+    return event.content().size() + event.data().size();
+  }
+
+  void WriteNextOrFinish(std::unique_lock<std::mutex> &lock) {
+    if (write_in_flight_ || finish_called_) {
+      return;
+    }
+    if (!pending_.empty()) {
+      in_flight_ = std::move(pending_.front());
+      pending_.pop_front();
+      pending_bytes_ -= event_bytes(in_flight_);
+      write_in_flight_ = true;
+      lock.unlock();
+      StartWrite(&in_flight_);
+      return;
+    }
+    if (done_queued_) {
+      finish_called_ = true;
+      lock.unlock();
+      Finish(grpc::Status::OK);
+    }
+  }
+
+  void FinishCancelled(std::unique_lock<std::mutex> &lock) {
+    if (finish_called_) {
+      return;
+    }
+    finish_called_ = true;
+    pending_.clear();
+    pending_bytes_ = 0;
+    lock.unlock();
+    Finish(grpc::Status(grpc::StatusCode::CANCELLED, "Stream cancelled"));
+  }
+
+  std::string name_;
+  std::shared_ptr<EvalStreamSink> sink_;
+  std::function<void()> on_cancel_;
+
+  std::mutex mutex_;
+  std::deque<EvalStreamEvent> pending_;
+  // of the events in pending_
+  std::size_t pending_bytes_ = 0;
+  // since the last event that was queued
+  std::size_t num_dropped_ = 0;
+  // the message being written, must stay alive until OnWriteDone
+  EvalStreamEvent in_flight_;
+  bool write_in_flight_ = false;
+  bool done_queued_ = false;
+  bool cancelled_ = false;
+  bool finish_called_ = false;
+};
+
+// the part of the stream that the RTask holds on to. the reactor deletes
+// itself in OnDone, possibly while the task is still running, so the sink
+// only forwards while the reactor is attached
+class EvalStreamSink : public RWorker::OutputEventSink {
+public:
+  explicit EvalStreamSink(EvalStreamReactor *reactor) : reactor_(reactor) {}
+
+  void push_event(RWorker::OutputEvent event) override {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (reactor_ != nullptr) {
+      reactor_->Push(std::move(event));
+    }
+  }
+
+  void Detach() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    reactor_ = nullptr;
+  }
+
+private:
+  std::mutex mutex_;
+  EvalStreamReactor *reactor_;
+};
+
+void EvalStreamReactor::OnDone() {
+  // waits out a push_event that is currently running
+  if (sink_) {
+    sink_->Detach();
+  }
+  delete this;
+}
+
+// chunks of a GetTable stream
+constexpr std::size_t table_chunk_bytes = 1024 * 1024;
+
+grpc::Status to_table_status(RWorker::ResponseStatus status,
+                             std::string message) {
+  switch (status) {
+  case RWorker::ResponseStatus::SUCCESS:
+    return grpc::Status::OK;
+  case RWorker::ResponseStatus::FAILURE_R_VIEW_ERROR:
+    return grpc::Status(grpc::StatusCode::INVALID_ARGUMENT, message);
+  case RWorker::ResponseStatus::CANCELLED:
+  case RWorker::ResponseStatus::EXPIRED:
+    return grpc::Status(grpc::StatusCode::CANCELLED, "Stream cancelled");
+  case RWorker::ResponseStatus::FAILURE_TIMEOUT:
+    // the client didn't read it in time
+    return grpc::Status(grpc::StatusCode::DEADLINE_EXCEEDED, message);
+  default:
+    return grpc::Status(grpc::StatusCode::INTERNAL,
+                        message.empty() ? "Reading the table failed"
+                                        : message);
+  }
+}
+
+RWorker::TableFilterOp to_table_filter_op(TableFilterOp op) {
+  switch (op) {
+  case TABLE_FILTER_NOT_EQUAL:
+    return RWorker::TableFilterOp::NOT_EQUAL;
+  case TABLE_FILTER_LESS:
+    return RWorker::TableFilterOp::LESS;
+  case TABLE_FILTER_LESS_EQUAL:
+    return RWorker::TableFilterOp::LESS_EQUAL;
+  case TABLE_FILTER_GREATER:
+    return RWorker::TableFilterOp::GREATER;
+  case TABLE_FILTER_GREATER_EQUAL:
+    return RWorker::TableFilterOp::GREATER_EQUAL;
+  case TABLE_FILTER_CONTAINS:
+    return RWorker::TableFilterOp::CONTAINS;
+  case TABLE_FILTER_IS_NA:
+    return RWorker::TableFilterOp::IS_NA;
+  case TABLE_FILTER_NOT_NA:
+    return RWorker::TableFilterOp::NOT_NA;
+  case TABLE_FILTER_EQUAL:
+  default:
+    return RWorker::TableFilterOp::EQUAL;
+  }
+}
+
+class TableStreamSink;
+
+// reactor for GetTable. the worker sends the Arrow IPC stream one message
+// per event (through TableStreamSink), they are queued and written out in
+// table_chunk_bytes chunks, small messages sharing a chunk. same threading
+// rules as EvalStreamReactor.
+//
+// none of the stream can be dropped, so a slow client slows its task down
+// instead. the worker sends at most table_stream_window_bytes ahead of what
+// was written to the client, every chunk written gives that many bytes back
+// to the task (RWorkerPool::grant_credit). so pending_ stays within the
+// window plus a message, and PushData() never waits: it runs on the pool's
+// reader thread of the worker, which all of the worker's tasks share.
+//
+// a client that cancels has the task cancelled with it (SetOnCancel), the
+// worker stops before its next message. when the worker gives up on a client
+// that doesn't read, the call is cancelled too
+class TableStreamReactor : public grpc::ServerWriteReactor<TableChunk> {
+public:
+  explicit TableStreamReactor(grpc::CallbackServerContext *context)
+      : context_(context) {}
+
+  void PushData(std::string data) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    if (cancelled_ || done_queued_ || data.empty()) {
+      return;
+    }
+    pending_bytes_ += data.size();
+    pending_.push_back(std::move(data));
+    WriteNextOrFinish(lock);
+  }
+
+  // the worker is done, with status for the client
+  void Done(grpc::Status status) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    if (cancelled_ || done_queued_) {
+      return;
+    }
+    // half a stream is no use to anyone
+    if (!status.ok()) {
+      pending_.clear();
+      pending_bytes_ = 0;
+      front_offset_ = 0;
+    }
+    // the worker waited too long for the client (FAILURE_TIMEOUT), so the
+    // write in flight most likely isn't being read. its OnWriteDone, and the
+    // Finish after it, could take forever, cancelling makes it come now
+    bool stalled = status.error_code() == grpc::StatusCode::DEADLINE_EXCEEDED;
+    final_status_ = std::move(status);
+    done_queued_ = true;
+    if (stalled && write_in_flight_) {
+      cancelled_ = true;
+      lock.unlock();
+      LOG(WARNING) << "GetTable: the client stopped reading, cancelling it";
+      context_->TryCancel();
+      return;
+    }
+    WriteNextOrFinish(lock);
+  }
+
+  void OnWriteDone(bool ok) override {
+    std::unique_lock<std::mutex> lock(mutex_);
+    write_in_flight_ = false;
+    if (!ok) {
+      cancelled_ = true;
+    }
+    if (cancelled_) {
+      FinishCancelled(lock);
+      return;
+    }
+    // before WriteNextOrFinish() reuses chunk_
+    std::size_t written = chunk_.arrow_ipc().size();
+    WriteNextOrFinish(lock);
+    if (lock.owns_lock()) {
+      lock.unlock();
+    }
+    // writes to the worker's socket, not under mutex_
+    if (on_written_) {
+      on_written_(written);
+    }
+  }
+
+  void OnCancel() override {
+    if (on_cancel_) {
+      on_cancel_();
+    }
+
+    std::unique_lock<std::mutex> lock(mutex_);
+    cancelled_ = true;
+    if (!write_in_flight_) {
+      FinishCancelled(lock);
+    }
+  }
+
+  void OnDone() override;
+
+  // set once by the handler before any event can arrive
+  void SetSink(std::shared_ptr<TableStreamSink> sink) {
+    sink_ = std::move(sink);
+  }
+  void SetOnCancel(std::function<void()> on_cancel) {
+    on_cancel_ = std::move(on_cancel);
+  }
+  // same, called with the bytes of every chunk the client got
+  void SetOnWritten(std::function<void(std::size_t)> on_written) {
+    on_written_ = std::move(on_written);
+  }
+
+private:
+  void WriteNextOrFinish(std::unique_lock<std::mutex> &lock) {
+    if (write_in_flight_ || finish_called_) {
+      return;
+    }
+    if (!pending_.empty()) {
+      chunk_.Clear();
+      std::string *out = chunk_.mutable_arrow_ipc();
+      while (!pending_.empty() && out->size() < table_chunk_bytes) {
+        const std::string &front = pending_.front();
+        std::size_t size = std::min(table_chunk_bytes - out->size(),
+                                    front.size() - front_offset_);
+        out->append(front, front_offset_, size);
+        front_offset_ += size;
+        pending_bytes_ -= size;
+        if (front_offset_ == front.size()) {
+          pending_.pop_front();
+          front_offset_ = 0;
+        }
+      }
+      write_in_flight_ = true;
+      lock.unlock();
+      StartWrite(&chunk_);
+      return;
+    }
+    if (done_queued_) {
+      finish_called_ = true;
+      lock.unlock();
+      Finish(std::move(final_status_));
+    }
+  }
+
+  void FinishCancelled(std::unique_lock<std::mutex> &lock) {
+    if (finish_called_) {
+      return;
+    }
+    finish_called_ = true;
+    pending_.clear();
+    pending_bytes_ = 0;
+    lock.unlock();
+    Finish(grpc::Status(grpc::StatusCode::CANCELLED, "Stream cancelled"));
+  }
+
+  // owned by gRPC, valid until OnDone
+  grpc::CallbackServerContext *context_;
+  std::shared_ptr<TableStreamSink> sink_;
+  std::function<void()> on_cancel_;
+  std::function<void(std::size_t)> on_written_;
+
+  std::mutex mutex_;
+  // Arrow IPC messages not yet written, front_offset_ bytes of the first one
+  // already are
+  std::deque<std::string> pending_;
+  std::size_t front_offset_ = 0;
+  // of pending_, not counting the front_offset_ bytes
+  std::size_t pending_bytes_ = 0;
+  // the chunk being written, must stay alive until OnWriteDone
+  TableChunk chunk_;
+  grpc::Status final_status_;
+  bool write_in_flight_ = false;
+  bool done_queued_ = false;
+  bool cancelled_ = false;
+  bool finish_called_ = false;
+};
+
+// what the VIEW_TABLE task holds on to, same as EvalStreamSink
+class TableStreamSink : public RWorker::OutputEventSink {
+public:
+  explicit TableStreamSink(TableStreamReactor *reactor) : reactor_(reactor) {}
+
+  void push_event(RWorker::OutputEvent event) override {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (reactor_ == nullptr) {
+      return;
+    }
+    if (event.type == RWorker::OutputEventType::TABLE_DATA) {
+      reactor_->PushData(std::move(event.content));
+    } else if (event.type == RWorker::OutputEventType::DONE) {
+      reactor_->Done(to_table_status(event.status, std::move(event.content)));
+    }
+  }
+
+  void Detach() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    reactor_ = nullptr;
+  }
+
+private:
+  std::mutex mutex_;
+  TableStreamReactor *reactor_;
+};
+
+void TableStreamReactor::OnDone() {
+  if (sink_) {
+    sink_->Detach();
+  }
+  delete this;
+}
+
+// how a management task went, from its DONE event: the status, and the
+// content as the answer on success or as the error otherwise
+void set_management_result(ManagementCodeResult &result,
+                           RWorker::ResponseStatus status,
+                           std::string content) {
+  result.set_status(to_eval_status(status));
+  if (status == RWorker::ResponseStatus::SUCCESS) {
+    result.set_value_summary(std::move(content));
+  } else {
+    result.set_error_message(std::move(content));
+  }
+}
+
+void set_management_result(CppCommandResult &result,
+                           RWorker::ResponseStatus status,
+                           std::string content) {
+  result.set_status(to_eval_status(status));
+  if (status == RWorker::ResponseStatus::SUCCESS) {
+    result.set_output(std::move(content));
+  } else {
+    result.set_error_message(std::move(content));
+  }
+}
+
+template <typename Result> class ManagementSink;
+
+// reactor for EvalManagementCode and RunCppCommand. answers once the
+// worker's DONE event (through ManagementSink) says how the task went, the
+// worker always sends one, even for a task that never ran. Finish is called
+// without holding mutex_, same as the stream reactors
+template <typename Result>
+class ManagementReactor : public grpc::ServerUnaryReactor {
+public:
+  explicit ManagementReactor(Result *response) : response_(response) {}
+
+  void Done(RWorker::ResponseStatus status, std::string content) {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      if (finish_called_) {
+        return;
+      }
+      finish_called_ = true;
+    }
+    set_management_result(*response_, status, std::move(content));
+    Finish(grpc::Status::OK);
+  }
+
+  void OnCancel() override {
+    if (on_cancel_) {
+      on_cancel_();
+    }
+
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      if (finish_called_) {
+        return;
+      }
+      finish_called_ = true;
+    }
+    Finish(grpc::Status(grpc::StatusCode::CANCELLED, "Call cancelled"));
+  }
+
+  void OnDone() override;
+
+  // set once by the handler before any event can arrive
+  void SetSink(std::shared_ptr<ManagementSink<Result>> sink) {
+    sink_ = std::move(sink);
+  }
+  void SetOnCancel(std::function<void()> on_cancel) {
+    on_cancel_ = std::move(on_cancel);
+  }
+
+private:
+  // owned by gRPC, valid until OnDone
+  Result *response_;
+  std::shared_ptr<ManagementSink<Result>> sink_;
+  std::function<void()> on_cancel_;
+
+  std::mutex mutex_;
+  bool finish_called_ = false;
+};
+
+// what the EXECUTE_R_CODE_MANAGEMENT/CPP_MANAGEMENT_TASK task holds on to,
+// same as EvalStreamSink. only the DONE event matters, its content is the
+// answer or the error message
+template <typename Result>
+class ManagementSink : public RWorker::OutputEventSink {
+public:
+  explicit ManagementSink(ManagementReactor<Result> *reactor)
+      : reactor_(reactor) {}
+
+  void push_event(RWorker::OutputEvent event) override {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (reactor_ != nullptr && event.type == RWorker::OutputEventType::DONE) {
+      reactor_->Done(event.status, std::move(event.content));
+    }
+  }
+
+  void Detach() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    reactor_ = nullptr;
+  }
+
+private:
+  std::mutex mutex_;
+  ManagementReactor<Result> *reactor_;
+};
+
+template <typename Result> void ManagementReactor<Result>::OnDone() {
+  if (sink_) {
+    sink_->Detach();
+  }
+  delete this;
+}
+
+
+} // namespace
 
 grpc::ServerUnaryReactor *
 REvalServiceImpl::EvalRScript(grpc::CallbackServerContext *context,
@@ -37,31 +877,44 @@ REvalServiceImpl::EvalRScript(grpc::CallbackServerContext *context,
 
   // construct an RTask with the factory method
   std::unique_ptr<RWorker::RTask> r_task =
-      RWorker::RTask::create_client_r_code_task(r_code);
+      RWorker::RTask::create_client_r_code_task(
+          r_code, to_plot_format_policy(request->plot_format()),
+          EvalTimeout(*request), EvalOutputLimits(*request));
+  r_task->set_session_id(request->session_id());
+  apply_task_class(*r_task, request->task_class());
+  apply_client_identity(*r_task, *context);
 
   // grab the name_uuid from the created RTask
   std::string eval_uuid = r_task->get_uuid();
 
-  // We have the necessary data, now we need to do two things:
-  // 1. Add the RTask to the TaskQueue
-  // 2. Construct the Operation in the EvalOperationStore
+  if (!client_queue_limits_.admit(r_task->get_client_id(), eval_uuid)) {
+    auto *reactor = context->DefaultReactor();
+    reactor->Finish(grpc::Status(grpc::StatusCode::RESOURCE_EXHAUSTED,
+                                 "Too many tasks queued for this client"));
+    return reactor;
+  }
+
+  // We have the necessary data, now we need to do three things:
+  // 1. Construct the Operation in the EvalOperationStore
+  // 2. Submit the RTask to the worker pool
   // 3. Construct the Response to the gRPC RPC
   //
-  // Do this in order to see that the R code might be done faster?
-  // Otherwise there is no neccesary/strict ordering
-
-  // enqueue the R Code Eval Task
-  task_queue_.enqueue(std::move(r_task));
+  // the operation has to exist before the task is enqueued, the worker
+  // wakes up immediately and a fast snippet could otherwise finish before
+  // the response thread has an operation to update
 
-  // next, construct the operation in the operation store
+  // construct the operation in the operation store
   // we need the name/uuid to index. creation time is automatically
   // set by the class and otherwise we just need to set the done to false
-  EvalOperation temp_operation =
+  std::shared_ptr<const EvalOperation> temp_operation =
       operation_store_.createEvalOperation(eval_uuid);
 
+  // submit the R Code Eval Task to the worker owning the session
+  worker_pool_.submit(std::move(r_task));
+
   // the operation is already in the operation store and the start time
   // is already set, so we need to set the response and then return.
-  response->CopyFrom(temp_operation);
+  response->CopyFrom(*temp_operation);
 
   // use simple example from docs with default Reactor
   // we might move to a custom reactor if we need to customize behavior
@@ -82,138 +935,589 @@ REvalServiceImpl::GetEvalOperation(grpc::CallbackServerContext *context,
   // to be correct.
   std::string requested_uuid = request->name();
 
-  // of course we return not-found if we do not find it
-  auto eval_operation = operation_store_.getEvalOperation(requested_uuid);
+  // of course we return not-found if we do not find it, with a different
+  // message if it existed but was evicted
+  EvalOperationLookup lookup = operation_store_.getEvalOperation(requested_uuid);
 
   auto *reactor = context->DefaultReactor();
-  if (eval_operation.has_value()) {
-    // eval operation exists in store
-    response->CopyFrom(eval_operation.value());
+  switch (lookup.status) {
+  case OperationLookupStatus::FOUND: {
+    // eval operation exists in store. the snapshot is immutable, so this
+    // copy happens without holding any store lock
+    response->CopyFrom(*lookup.operation);
+
+    // plots are fetched with GetPlot by clients that want references,
+    // everyone else gets them inline as before
+    if (response->has_eval_result() && !request->plots_by_reference()) {
+      bool inlined = false;
+      try {
+        inlined = inline_plots(*response->mutable_eval_result(), plot_store_);
+      } catch (const std::exception &e) {
+        LOG(ERROR) << "GetEvalOperation " << requested_uuid
+                   << ": stored plot is corrupt: " << e.what();
+        reactor->Finish(grpc::Status(grpc::StatusCode::INTERNAL,
+                                     "Stored plot could not be decoded"));
+        break;
+      }
+      if (!inlined) {
+        reactor->Finish(grpc::Status(
+            grpc::StatusCode::NOT_FOUND,
+            "Operation expired and was evicted from the store"));
+        break;
+      }
+    }
+
+    // compressed output stays compressed for clients that can take it
+    if (response->has_eval_result() &&
+        !accepts_encoding(*request,
+                          response->eval_result().output_encoding())) {
+      try {
+        decompress_eval_result(*response->mutable_eval_result());
+      } catch (const std::exception &e) {
+        LOG(ERROR) << "GetEvalOperation " << requested_uuid
+                   << ": stored output is corrupt: " << e.what();
+        reactor->Finish(grpc::Status(grpc::StatusCode::INTERNAL,
+                                     "Stored output could not be decoded"));
+        break;
+      }
+    }
+    // anything big that is still plain gets gRPC's message compression,
+    // with whatever algorithm the client accepts
+    if (response->ByteSizeLong() >= grpc_compression_min_bytes) {
+      context->set_compression_level(GRPC_COMPRESS_LEVEL_LOW);
+    }
     reactor->Finish(grpc::Status::OK);
-    return reactor;
-  } else {
+    break;
+  }
+  case OperationLookupStatus::EXPIRED:
+    reactor->Finish(grpc::Status(
+        grpc::StatusCode::NOT_FOUND,
+        "Operation expired and was evicted from the store"));
+    break;
+  case OperationLookupStatus::NOT_FOUND:
+  default:
     // eval operation *does NOT* exist in store
     reactor->Finish(grpc::Status(grpc::StatusCode::NOT_FOUND,
                                  "Operation doesn't exist in store"));
-    return reactor;
+    break;
   }
+  return reactor;
 }
 
 grpc::ServerUnaryReactor *
 REvalServiceImpl::CancelEvalOperation(grpc::CallbackServerContext *context,
                                       const CancelEvalOperationRequest *request,
                                       google::protobuf::Empty *response) {
-  // unimplemented
+  // cancelling is asynchronous, OK only means the worker was asked to. the
+  // operation is done once the worker answers, with EVAL_CANCELLED if the
+  // cancel got there before the evaluation finished
+  EvalOperationLookup lookup = operation_store_.getEvalOperation(request->name());
+
+  auto *reactor = context->DefaultReactor();
+  switch (lookup.status) {
+  case OperationLookupStatus::FOUND:
+    if (lookup.operation->done()) {
+      reactor->Finish(grpc::Status(grpc::StatusCode::FAILED_PRECONDITION,
+                                   "Operation is already done"));
+    } else if (!worker_pool_.cancel(request->name())) {
+      // its response is on the way, or its worker just died
+      reactor->Finish(grpc::Status(grpc::StatusCode::FAILED_PRECONDITION,
+                                   "Operation is no longer running"));
+    } else {
+      reactor->Finish(grpc::Status::OK);
+    }
+    break;
+  case OperationLookupStatus::EXPIRED:
+    reactor->Finish(grpc::Status(
+        grpc::StatusCode::NOT_FOUND,
+        "Operation expired and was evicted from the store"));
+    break;
+  case OperationLookupStatus::NOT_FOUND:
+  default:
+    reactor->Finish(grpc::Status(grpc::StatusCode::NOT_FOUND,
+                                 "Operation doesn't exist in store"));
+    break;
+  }
+  return reactor;
+}
+
+grpc::ServerUnaryReactor *
+REvalServiceImpl::GetServerStats(grpc::CallbackServerContext *context,
+                                 const google::protobuf::Empty *request,
+                                 ServerStats *response) {
+  EvalOperationStoreStats store_stats = operation_store_.getStats();
+
+  auto *store_pbuf = response->mutable_operation_store();
+  store_pbuf->set_operations(store_stats.num_operations);
+  store_pbuf->set_running_operations(store_stats.num_running);
+  store_pbuf->set_total_bytes(store_stats.total_bytes);
+  store_pbuf->set_evicted_total(store_stats.num_evicted);
+
+  PlotStoreCounters plot_stats = plot_store_.getStats();
+  auto *plot_pbuf = response->mutable_plot_store();
+  plot_pbuf->set_plots(plot_stats.num_plots);
+  plot_pbuf->set_total_bytes(plot_stats.total_bytes);
+  plot_pbuf->set_deduplicated_total(plot_stats.num_deduplicated);
+
+  auto *queue_pbuf = response->mutable_task_queue();
+  queue_pbuf->set_tasks_run(task_queue_counters_.tasks_run);
+  queue_pbuf->set_tasks_expired(task_queue_counters_.tasks_expired);
+  queue_pbuf->set_queue_wait_ms_total(task_queue_counters_.queue_wait_ms_total);
+  queue_pbuf->set_queue_wait_ms_max(task_queue_counters_.queue_wait_ms_max);
+  queue_pbuf->set_run_ms_total(task_queue_counters_.run_ms_total);
+  queue_pbuf->set_tasks_finished_past_deadline(
+      task_queue_counters_.tasks_finished_past_deadline);
+  queue_pbuf->set_tasks_rejected(client_queue_limits_.numRejected());
+  for (std::size_t i = 0; i < task_queue_counters_.classes.size(); ++i) {
+    const TaskClassCounters &class_counters = task_queue_counters_.classes[i];
+    TaskClassQueueStats *class_pbuf = queue_pbuf->add_classes();
+    class_pbuf->set_task_class(
+        to_task_class_proto(static_cast<RWorker::TaskClass>(i)));
+    class_pbuf->set_tasks(class_counters.tasks);
+    class_pbuf->set_queue_wait_us_total(class_counters.queue_wait_us_total);
+    class_pbuf->set_queue_wait_us_max(class_counters.queue_wait_us_max);
+  }
+
+  auto *reactor = context->DefaultReactor();
+  reactor->Finish(grpc::Status::OK);
+  return reactor;
+}
+
+grpc::ServerWriteReactor<PlotChunk> *
+REvalServiceImpl::GetPlot(grpc::CallbackServerContext *context,
+                          const GetPlotRequest *request) {
+  std::shared_ptr<const StoredPlot> plot = plot_store_.getPlot(request->id());
+  if (plot == nullptr) {
+    return new PlotChunkReactor(grpc::Status(
+        grpc::StatusCode::NOT_FOUND, "Plot doesn't exist in store"));
+  }
+
+  // sent as stored if the client can decode it, no copy then
+  if (accepts_encoding(*request, plot->encoding)) {
+    std::shared_ptr<const std::string> data(plot, &plot->data);
+    return new PlotChunkReactor(plot->ref, plot->encoding, std::move(data));
+  }
+
+  std::shared_ptr<const std::string> data;
+  try {
+    data = std::make_shared<const std::string>(decoded_plot_data(*plot));
+  } catch (const std::exception &e) {
+    LOG(ERROR) << "GetPlot " << request->id()
+               << ": stored plot is corrupt: " << e.what();
+    return new PlotChunkReactor(grpc::Status(
+        grpc::StatusCode::INTERNAL, "Stored plot could not be decoded"));
+  }
+  return new PlotChunkReactor(plot->ref, CONTENT_ENCODING_IDENTITY,
+                              std::move(data));
+}
+
+grpc::ServerWriteReactor<EvalStreamEvent> *
+REvalServiceImpl::EvalRScriptStream(grpc::CallbackServerContext *context,
+                                    const EvalRScriptRequest *request) {
+  std::unique_ptr<RWorker::RTask> r_task =
+      RWorker::RTask::create_client_r_code_task(
+          request->r_code(), to_plot_format_policy(request->plot_format()),
+          EvalTimeout(*request), EvalOutputLimits(*request));
+  r_task->set_session_id(request->session_id());
+  apply_task_class(*r_task, request->task_class());
+  apply_client_identity(*r_task, *context);
+  // this call lasts as long as the evaluation, the client waits on it for
+  // the result. (EvalRScript returns before the task even runs, the
+  // deadline of that call says nothing about how long the result is wanted)
+  r_task->set_client_deadline(client_deadline(*context));
+  std::string eval_uuid = r_task->get_uuid();
+
+  if (!client_queue_limits_.admit(r_task->get_client_id(), eval_uuid)) {
+    return new EvalStreamReactor(
+        grpc::Status(grpc::StatusCode::RESOURCE_EXHAUSTED,
+                     "Too many tasks queued for this client"));
+  }
+
+  auto *reactor = new EvalStreamReactor(eval_uuid);
+  auto sink = std::make_shared<EvalStreamSink>(reactor);
+  reactor->SetSink(sink);
+  reactor->SetOnCancel(
+      [this, eval_uuid] { worker_pool_.abandon(eval_uuid); });
+  r_task->set_event_sink(std::move(sink));
+
+  // store the operation before enqueueing so the response thread always
+  // finds it
+  operation_store_.createEvalOperation(eval_uuid);
+  worker_pool_.submit(std::move(r_task));
+
+  return reactor;
+}
+
+grpc::ServerUnaryReactor *
+REvalServiceImpl::EvalRScriptBatch(grpc::CallbackServerContext *context,
+                                   const EvalRScriptBatchRequest *request,
+                                   EvalOperation *response) {
   auto *reactor = context->DefaultReactor();
-  reactor->Finish(grpc::Status(
-      grpc::StatusCode::UNIMPLEMENTED,
-      "CancelEvalOperation is not implemented yet. It does nothing."));
+  if (request->snippets_size() == 0 ||
+      static_cast<std::size_t>(request->snippets_size()) >
+          max_batch_snippets) {
+    reactor->Finish(grpc::Status(grpc::StatusCode::INVALID_ARGUMENT,
+                                 "A batch needs 1 to " +
+                                     std::to_string(max_batch_snippets) +
+                                     " snippets"));
+    return reactor;
+  }
+
+  RWorker::RCodeBatchPayload batch;
+  batch.snippets.assign(request->snippets().begin(),
+                        request->snippets().end());
+  batch.stop_on_error = !request->continue_on_error();
+  batch.plot_policy = to_plot_format_policy(request->plot_format());
+  batch.timeout = EvalTimeout(*request);
+  batch.output_limits = EvalOutputLimits(*request);
+
+  std::unique_ptr<RWorker::RTask> r_task =
+      RWorker::RTask::create_client_r_code_batch_task(std::move(batch));
+  r_task->set_session_id(request->session_id());
+  apply_task_class(*r_task, request->task_class());
+  apply_client_identity(*r_task, *context);
+  std::string eval_uuid = r_task->get_uuid();
+
+  // every snippet takes a slot, as it would have as its own EvalRScript
+  if (!client_queue_limits_.admit(r_task->get_client_id(), eval_uuid,
+                                  r_task->get_cost())) {
+    reactor->Finish(grpc::Status(grpc::StatusCode::RESOURCE_EXHAUSTED,
+                                 "Too many tasks queued for this client"));
+    return reactor;
+  }
+
+  // same order as EvalRScript, the operation exists before the task runs
+  std::shared_ptr<const EvalOperation> temp_operation =
+      operation_store_.createEvalOperation(eval_uuid);
+  worker_pool_.submit(std::move(r_task));
+
+  response->CopyFrom(*temp_operation);
+  reactor->Finish(grpc::Status::OK);
+  return reactor;
+}
+
+grpc::ServerWriteReactor<TableChunk> *
+REvalServiceImpl::GetTable(grpc::CallbackServerContext *context,
+                           const GetTableRequest *request) {
+  auto *reactor = new TableStreamReactor(context);
+  if (request->variable().empty()) {
+    reactor->Done(grpc::Status(grpc::StatusCode::INVALID_ARGUMENT,
+                               "No variable given"));
+    return reactor;
+  }
+
+  RWorker::TableViewPayload table_view;
+  table_view.variable = request->variable();
+  table_view.offset = request->offset();
+  table_view.max_rows = request->max_rows();
+  table_view.batch_rows = request->batch_rows();
+  for (const TableSortKey &key : request->sort()) {
+    table_view.sort.push_back(
+        RWorker::TableSortKey{key.column(), key.descending()});
+  }
+  for (const TableFilter &filter : request->filters()) {
+    table_view.filters.push_back(RWorker::TableFilter{
+        filter.column(), to_table_filter_op(filter.op()), filter.value()});
+  }
+
+  // not an operation, nothing is stored. the table goes out as the worker
+  // produces it and the response only clears the task from the pool
+  std::unique_ptr<RWorker::RTask> r_task =
+      RWorker::RTask::create_table_view_task(std::move(table_view));
+  r_task->set_session_id(request->session_id());
+  apply_task_class(*r_task, request->task_class());
+  apply_client_identity(*r_task, *context);
+  r_task->set_client_deadline(client_deadline(*context));
+  std::string task_uuid = r_task->get_uuid();
+
+  auto sink = std::make_shared<TableStreamSink>(reactor);
+  reactor->SetSink(sink);
+  // not abandon(), a running view would go on encoding the rest of the table
+  // for nobody
+  reactor->SetOnCancel(
+      [this, task_uuid] { worker_pool_.cancel(task_uuid); });
+  reactor->SetOnWritten([this, task_uuid](std::size_t bytes) {
+    worker_pool_.grant_credit(task_uuid, bytes);
+  });
+  r_task->set_event_sink(std::move(sink));
+
+  worker_pool_.submit(std::move(r_task));
   return reactor;
 }
 
+grpc::ServerUnaryReactor *
+REvalServiceImpl::EvalManagementCode(grpc::CallbackServerContext *context,
+                                     const EvalManagementCodeRequest *request,
+                                     ManagementCodeResult *response) {
+  std::unique_ptr<RWorker::RTask> r_task =
+      RWorker::RTask::create_management_r_code_task(request->r_code(),
+                                                    EvalTimeout(*request));
+  r_task->set_session_id(request->session_id());
+  apply_task_class(*r_task, request->task_class());
+  apply_client_identity(*r_task, *context);
+  return SubmitManagementTask(*context, std::move(r_task), response);
+}
+
+grpc::ServerUnaryReactor *
+REvalServiceImpl::RunCppCommand(grpc::CallbackServerContext *context,
+                                const CppCommandRequest *request,
+                                CppCommandResult *response) {
+  std::unique_ptr<RWorker::RTask> r_task =
+      RWorker::RTask::create_cpp_management_task(
+          request->command(), std::vector<std::string>(
+                                  request->arguments().begin(),
+                                  request->arguments().end()));
+  r_task->set_session_id(request->session_id());
+  apply_task_class(*r_task, request->task_class());
+  apply_client_identity(*r_task, *context);
+  return SubmitManagementTask(*context, std::move(r_task), response);
+}
+
+template <typename Result>
+grpc::ServerUnaryReactor *REvalServiceImpl::SubmitManagementTask(
+    grpc::CallbackServerContext &context,
+    std::unique_ptr<RWorker::RTask> r_task, Result *response) {
+  // no operation, the answer comes with the DONE event and the response only
+  // clears the task from the pool
+  r_task->set_client_deadline(client_deadline(context));
+  std::string task_uuid = r_task->get_uuid();
+
+  auto *reactor = new ManagementReactor<Result>(response);
+  auto sink = std::make_shared<ManagementSink<Result>>(reactor);
+  reactor->SetSink(sink);
+  reactor->SetOnCancel(
+      [this, task_uuid] { worker_pool_.abandon(task_uuid); });
+  r_task->set_event_sink(std::move(sink));
+
+  worker_pool_.submit(std::move(r_task));
+  return reactor;
+}
+
+void REvalServiceImpl::CountTaskTiming(const RWorker::RResponse &response) {
+  const RWorker::TaskTiming &timing = response.get_timing();
+  uint64_t queue_wait_ms =
+      std::chrono::duration_cast<std::chrono::milliseconds>(timing.queue_wait)
+          .count();
+  task_queue_counters_.queue_wait_ms_total += queue_wait_ms;
+  // only this thread writes, no compare-exchange needed
+  if (queue_wait_ms > task_queue_counters_.queue_wait_ms_max) {
+    task_queue_counters_.queue_wait_ms_max = queue_wait_ms;
+  }
+
+  auto class_index = static_cast<std::size_t>(timing.task_class);
+  if (class_index < task_queue_counters_.classes.size()) {
+    TaskClassCounters &class_counters =
+        task_queue_counters_.classes[class_index];
+    auto queue_wait_us = static_cast<uint64_t>(timing.queue_wait.count());
+    ++class_counters.tasks;
+    class_counters.queue_wait_us_total += queue_wait_us;
+    if (queue_wait_us > class_counters.queue_wait_us_max) {
+      class_counters.queue_wait_us_max = queue_wait_us;
+    }
+  }
+
+  if (response.get_status() == RWorker::ResponseStatus::EXPIRED) {
+    ++task_queue_counters_.tasks_expired;
+    return;
+  }
+  ++task_queue_counters_.tasks_run;
+  task_queue_counters_.run_ms_total +=
+      std::chrono::duration_cast<std::chrono::milliseconds>(timing.run_time)
+          .count();
+  if (timing.finished_past_deadline) {
+    ++task_queue_counters_.tasks_finished_past_deadline;
+  }
+}
+
+template <typename Request>
+std::chrono::milliseconds
+REvalServiceImpl::EvalTimeout(const Request &request) const {
+  if (!request.has_timeout()) {
+    return default_eval_timeout_;
+  }
+  auto timeout =
+      std::chrono::duration_cast<std::chrono::milliseconds>(
+          std::chrono::seconds(request.timeout().seconds()) +
+          std::chrono::nanoseconds(request.timeout().nanos()));
+  // zero or negative is no time limit at all, take it as unset
+  return timeout > std::chrono::milliseconds::zero() ? timeout
+                                                     : default_eval_timeout_;
+}
+
+template <typename Request>
+RWorker::OutputLimits
+REvalServiceImpl::EvalOutputLimits(const Request &request) const {
+  RWorker::OutputLimits limits = output_limits_;
+  const ConsoleOutputLimits &requested = request.output_limits();
+  if (requested.max_lines() > 0) {
+    limits.max_lines = std::min<std::size_t>(limits.max_lines,
+                                             requested.max_lines());
+  }
+  if (requested.max_bytes() > 0) {
+    limits.max_bytes = std::min<std::size_t>(limits.max_bytes,
+                                             requested.max_bytes());
+  }
+  return limits;
+}
+
 void REvalServiceImpl::ProcessRResponseQueue(std::stop_token stop_token) {
   // this will be called and have access to the queue and operation store
   //
-  // we need to work in a busy loop and dequeue RResponses off of the
-  // response queue, modify the operation store, and check if the stop_token
-  // has been signaled.
+  // we block on the response queue and dequeue RResponses as soon as the
+  // R worker enqueues them, modify the operation store, and check if the
+  // stop_token has been signaled whenever the wait times out.
   //
   // to check the stop_token, call stop_token.stop_requested()
   LOG(INFO) << "RResponse queue processing thread starting up!";
 
   // while loop that should be gated on the stop_token
   while (!stop_token.stop_requested()) {
-    // if in here we are alive
-    // we need to:
-    // 1. is a response ready
-    // 2. sleep
-
     std::unique_ptr<RWorker::RResponse> r_response;
-    if (response_queue_.try_dequeue(r_response)) {
-      // if we're here we have a dequeued r_response
-
-      std::string eval_uuid = r_response->get_task_uuid();
-      RWorker::ResponseStatus eval_status = r_response->get_status();
-      RWorker::ResultData eval_data = r_response->get_result_payload();
-
-      LOG(INFO) << "RResponse Status: " << eval_status
-                << "gotten off of queue.";
-
-      // we have the uuid and can call updateEvalOperation
-      operation_store_.updateEvalOperation(eval_uuid, [&](EvalOperation
-                                                              &op_protobuf) {
-        switch (eval_status) {
-        // right now we are only sending R code
-        // as client code, so it will either be success
-        // failure w/ error, or we just mark it as done
-        // and be done with it. later we will add handling
-        case RWorker::ResponseStatus::SUCCESS: {
-          std::vector<std::string> output_text =
-              std::get<RWorker::RClientOutputPayload>(eval_data).console_output;
-
-          std::vector<std::string> svg_text =
-              std::get<RWorker::RClientOutputPayload>(eval_data).graphic_output;
-
-          // we have the output, now add it to the proto
-          auto eval_result_pbuf = op_protobuf.mutable_eval_result();
-
-          // set status, need to set lines too
-          eval_result_pbuf->set_status(EVAL_SUCCESS);
-
-          eval_result_pbuf->clear_interpreter_lines();
-          for (std::string &line : output_text) {
-            eval_result_pbuf->add_interpreter_lines(line);
-          }
-
-          eval_result_pbuf->clear_svg_plots();
-          for (std::string &svg : svg_text) {
-            eval_result_pbuf->add_svg_plots(svg);
-          }
-
-          op_protobuf.set_done(true);
-          break;
-        }
-        case RWorker::ResponseStatus::FAILURE_R_SCRIPT_ERROR: {
-          std::vector<std::string> output_text =
-              std::get<RWorker::RClientOutputPayload>(eval_data).console_output;
 
-          std::vector<std::string> svg_text =
-              std::get<RWorker::RClientOutputPayload>(eval_data).graphic_output;
+    // wakes up immediately on enqueue, the timeout only exists so that
+    // shutdown is noticed while idle
+    if (!response_queue_.wait_dequeue_timed(r_response,
+                                            response_wait_timeout)) {
+      continue;
+    }
+
+    // if we're here we have a dequeued r_response
+
+    std::string eval_uuid = r_response->get_task_uuid();
+    RWorker::ResponseStatus eval_status = r_response->get_status();
+    // failures from the pool itself never reached a worker, nothing to count
+    if (eval_status != RWorker::ResponseStatus::FAILURE_TASK_EXECUTION) {
+      CountTaskTiming(*r_response);
+    }
 
-          // we have the output, now add it to the proto
-          auto eval_result_pbuf = op_protobuf.mutable_eval_result();
+    // management, C++ command and table tasks have no operation and weren't
+    // admitted by client_queue_limits_. their client got its answer through
+    // the task's sink, the response only cleared the task from the pool
+    RWorker::TaskType task_type = r_response->get_task_type();
+    if (task_type != RWorker::TaskType::EXECUTE_R_CODE_CLIENT &&
+        task_type != RWorker::TaskType::EXECUTE_R_CODE_BATCH) {
+      continue;
+    }
 
-          // set status, need to set lines too
-          eval_result_pbuf->set_status(EVAL_R_CODE_ERROR);
+    // the client may queue another one
+    client_queue_limits_.release(eval_uuid);
 
-          for (std::string &line : output_text) {
-            eval_result_pbuf->add_interpreter_lines(line);
-          }
+    LOG(INFO) << "RResponse Status: " << eval_status
+              << "gotten off of queue.";
 
-          for (std::string &svg : svg_text) {
-            eval_result_pbuf->add_svg_plots(svg);
-          }
+    // the output is moved, not copied, from the response into the result
+    // proto here, outside of the store. the updater then only swaps it in
+    std::optional<EvalResult> eval_result;
+    std::optional<std::string> error_message;
+    switch (eval_status) {
+    // right now we are only sending R code
+    // as client code, so it will either be success
+    // failure w/ error, or we just mark it as done
+    // and be done with it. later we will add handling
+    case RWorker::ResponseStatus::SUCCESS:
+    case RWorker::ResponseStatus::FAILURE_R_SCRIPT_ERROR:
+    // a cancelled or timed out task keeps whatever output it had produced
+    case RWorker::ResponseStatus::CANCELLED:
+    case RWorker::ResponseStatus::FAILURE_TIMEOUT:
+    // dropped before it ran, no output at all
+    case RWorker::ResponseStatus::EXPIRED: {
+      RWorker::ResultData eval_data = r_response->take_result_payload();
+      auto *client_output = std::get_if<RWorker::RClientOutputPayload>(&eval_data);
 
-          op_protobuf.set_done(true);
-          break;
+      // we have the output, now add it to the proto
+      eval_result.emplace();
+      // set status, need to set lines too
+      eval_result->set_status(to_eval_status(eval_status));
+      if (client_output != nullptr) {
+        eval_result->mutable_interpreter_lines()->Reserve(
+            client_output->console_output.size());
+        for (std::string &line : client_output->console_output) {
+          eval_result->add_interpreter_lines(std::move(line));
         }
-        default: {
-          op_protobuf.set_done(true);
-          // TODO: handle this
-          LOG(WARNING) << "Response Status Not Implemented";
-          break;
+        set_console_output_stats(*eval_result->mutable_console_output_stats(),
+                                 client_output->console_sizes);
+        // batches, the output above is the snippets' put together
+        eval_result->mutable_snippet_results()->Reserve(
+            client_output->snippets.size());
+        for (const RWorker::SnippetResult &snippet : client_output->snippets) {
+          EvalSnippetResult *snippet_pbuf = eval_result->add_snippet_results();
+          snippet_pbuf->set_status(to_eval_status(snippet.status));
+          snippet_pbuf->set_first_line(snippet.first_line);
+          snippet_pbuf->set_num_lines(snippet.num_lines);
+          snippet_pbuf->set_first_plot(snippet.first_plot);
+          snippet_pbuf->set_num_plots(snippet.num_plots);
+          set_console_output_stats(
+              *snippet_pbuf->mutable_console_output_stats(),
+              snippet.console_sizes);
+          *snippet_pbuf->mutable_run_time() =
+              google::protobuf::util::TimeUtil::MicrosecondsToDuration(
+                  snippet.run_time.count());
         }
+        // plots are stored once in the plot store, the result only keeps
+        // references. GetEvalOperation inlines them for clients that want
+        // them in svg_plots/plots
+        eval_result->set_requested_plot_format(
+            to_requested_plot_format(client_output->plot_policy));
+        eval_result->mutable_plot_refs()->Reserve(
+            client_output->graphic_output.size());
+        for (RWorker::PlotOutput &plot : client_output->graphic_output) {
+          *eval_result->add_plot_refs() = plot_store_.putPlot(
+              to_plot_format(plot.format), std::move(plot.data));
         }
-      });
+      }
 
-      // if there was a task we immediately get another
-      // if not we wait 20 milli
-      continue;
+      // compressed once here, it stays compressed in the store
+      try {
+        compress_eval_result(*eval_result, compression_options_);
+      } catch (const std::exception &e) {
+        LOG(WARNING) << "Storing the output of " << eval_uuid
+                     << " uncompressed: " << e.what();
+      }
+      break;
+    }
+    case RWorker::ResponseStatus::FAILURE_TASK_EXECUTION:
+      // the task never produced output, e.g. its worker process died
+      error_message = r_response->take_error_message();
+      break;
+    default:
+      break;
     }
 
-    // sleep :)
-    // this should possibly be configurable or a better solution be found?
-    std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    // we have the uuid and can call updateEvalOperation
+    bool updated = operation_store_.updateEvalOperation(eval_uuid, [&](EvalOperation
+                                                          &op_protobuf) {
+      switch (eval_status) {
+      case RWorker::ResponseStatus::SUCCESS:
+      case RWorker::ResponseStatus::FAILURE_R_SCRIPT_ERROR:
+      case RWorker::ResponseStatus::CANCELLED:
+      case RWorker::ResponseStatus::FAILURE_TIMEOUT:
+      case RWorker::ResponseStatus::EXPIRED:
+        // no arenas, so move assignment is a swap and the strings stay put
+        *op_protobuf.mutable_eval_result() = std::move(*eval_result);
+        op_protobuf.set_done(true);
+        break;
+      case RWorker::ResponseStatus::FAILURE_TASK_EXECUTION: {
+        auto error_pbuf = op_protobuf.mutable_error();
+        error_pbuf->set_code(static_cast<int32_t>(grpc::StatusCode::INTERNAL));
+        error_pbuf->set_message(
+            std::move(error_message).value_or("Task execution failed"));
+
+        op_protobuf.set_done(true);
+        break;
+      }
+      default: {
+        op_protobuf.set_done(true);
+        // TODO: handle this
+        LOG(WARNING) << "Response Status Not Implemented";
+        break;
+      }
+      }
+    });
+
+    // nobody holds the plot references of a result that wasn't stored
+    if (!updated && eval_result.has_value()) {
+      plot_store_.releasePlots(*eval_result);
+    }
   }
 
   LOG(INFO) << "RResponse queue processing thread shutting down!";
@@ -3,26 +3,48 @@
 #include <grpcpp/grpcpp.h>
 #include "r_result.h"
 #include "reval_service.grpc.pb.h"
+#include "client_queue_limits.h"
 #include "operation_store.h"
+#include "payload_compression.h"
+#include "plot_store.h"
 #include "r_task.h"
+#include "r_worker_pool.h"
 #include "reval_service.pb.h"
 
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
 #include <stop_token>
 #include <thread>
+#include <blockingconcurrentqueue.h>
 #include <concurrentqueue.h>
 
 class REvalServiceImpl final : public REvalService::CallbackService {
 public:
-  // constructor with references to the task queue and op store
+  // constructor with references to the R worker pool and op store
   // will need to add anything that will need to be accessed in the
   // grpc handlers
   explicit REvalServiceImpl(
     EvalOperationStore& operation_store,
-    moodycamel::ConcurrentQueue<std::unique_ptr<RWorker::RTask>>& task_queue,
-    moodycamel::ConcurrentQueue<std::unique_ptr<RWorker::RResponse>>& response_queue
-  ) : operation_store_(operation_store),
-    task_queue_(task_queue), response_queue_(response_queue),
-    response_thread_(&REvalServiceImpl::ProcessRResponseQueue, this) {}
+    RWorker::RWorkerPool& worker_pool,
+    PlotStore& plot_store,
+    moodycamel::BlockingConcurrentQueue<std::unique_ptr<RWorker::RResponse>>& response_queue,
+    PayloadCompressionOptions compression_options = {},
+    std::chrono::milliseconds default_eval_timeout = {},
+    RWorker::OutputLimits output_limits = {},
+    ClientQueueLimitsConfig client_queue_limits = {}
+  ) : operation_store_(operation_store), plot_store_(plot_store),
+    worker_pool_(worker_pool), response_queue_(response_queue),
+    compression_options_(compression_options),
+    default_eval_timeout_(default_eval_timeout),
+    output_limits_(output_limits),
+    client_queue_limits_(std::move(client_queue_limits)),
+    // jthread only passes its stop_token as the first argument, which does
+    // not work with a member function pointer, hence the lambda
+    response_thread_([this](std::stop_token stop_token) {
+      ProcessRResponseQueue(stop_token);
+    }) {}
 
   // actual rpc handler signatures
   grpc::ServerUnaryReactor* EvalRScript(
@@ -40,17 +62,110 @@ public:
     const CancelEvalOperationRequest* request,
     google::protobuf::Empty* response) override;
 
+  // gauges/counters for monitoring
+  grpc::ServerUnaryReactor* GetServerStats(
+    grpc::CallbackServerContext* context,
+    const google::protobuf::Empty* request,
+    ServerStats* response) override;
+
+  // chunked plot download, see PlotChunkReactor in the .cpp
+  grpc::ServerWriteReactor<PlotChunk>* GetPlot(
+    grpc::CallbackServerContext* context,
+    const GetPlotRequest* request) override;
+
+  // a data frame of a session as Arrow IPC, see TableStreamReactor in the
+  // .cpp
+  grpc::ServerWriteReactor<TableChunk>* GetTable(
+    grpc::CallbackServerContext* context,
+    const GetTableRequest* request) override;
+
+  // R code that only reports success/failure and a value summary, see
+  // ManagementReactor in the .cpp
+  grpc::ServerUnaryReactor* EvalManagementCode(
+    grpc::CallbackServerContext* context,
+    const EvalManagementCodeRequest* request,
+    ManagementCodeResult* response) override;
+
+  // a command of the workers' C++ command table (r_cpp_commands.h)
+  grpc::ServerUnaryReactor* RunCppCommand(
+    grpc::CallbackServerContext* context,
+    const CppCommandRequest* request,
+    CppCommandResult* response) override;
+
+  // streaming variant of EvalRScript, see EvalStreamReactor in the .cpp
+  grpc::ServerWriteReactor<EvalStreamEvent>* EvalRScriptStream(
+    grpc::CallbackServerContext* context,
+    const EvalRScriptRequest* request) override;
+
+  // several snippets as one task and one operation
+  grpc::ServerUnaryReactor* EvalRScriptBatch(
+    grpc::CallbackServerContext* context,
+    const EvalRScriptBatchRequest* request,
+    EvalOperation* response) override;
+
 private:
   EvalOperationStore& operation_store_;
-  moodycamel::ConcurrentQueue<std::unique_ptr<RWorker::RTask>>& task_queue_;
-  moodycamel::ConcurrentQueue<std::unique_ptr<RWorker::RResponse>>& response_queue_;
+  // plots of stored results, referenced from their plot_refs
+  PlotStore& plot_store_;
+  // tasks go to the worker process owning the task's session
+  RWorker::RWorkerPool& worker_pool_;
+  moodycamel::BlockingConcurrentQueue<std::unique_ptr<RWorker::RResponse>>& response_queue_;
+  // results are compressed by the response thread before they are stored
+  const PayloadCompressionOptions compression_options_;
+  // time limit of evaluations whose request has none, zero for no limit
+  const std::chrono::milliseconds default_eval_timeout_;
+  // console output limits of requests without their own, and the most a
+  // request may ask for
+  const RWorker::OutputLimits output_limits_;
+  // how many tasks a client may have queued, only client code counts
+  ClientQueueLimits client_queue_limits_;
+
+  // TaskClassQueueStats, by RWorker::TaskClass
+  struct TaskClassCounters {
+    std::atomic<uint64_t> tasks{0};
+    std::atomic<uint64_t> queue_wait_us_total{0};
+    std::atomic<uint64_t> queue_wait_us_max{0};
+  };
+
+  // TaskQueueStats, only written by the response thread
+  struct TaskQueueCounters {
+    std::atomic<uint64_t> tasks_run{0};
+    std::atomic<uint64_t> tasks_expired{0};
+    std::atomic<uint64_t> queue_wait_ms_total{0};
+    std::atomic<uint64_t> queue_wait_ms_max{0};
+    std::atomic<uint64_t> run_ms_total{0};
+    std::atomic<uint64_t> tasks_finished_past_deadline{0};
+    std::array<TaskClassCounters, RWorker::num_task_classes> classes;
+  };
+  TaskQueueCounters task_queue_counters_;
   // bg task
   std::jthread response_thread_;
 
   // private function to be called as a thread that will get responses off of the
-  // response queue and modify the operation store based on the contents
+  // response queue and modify the operation store based on the contents.
+  // blocks on the queue so a response is applied as soon as the worker
+  // enqueues it
   //
   // TODO: consider how to handle queue type errors (i.e. two responses for one task)
   //        -- realistically shouldn't happen
   void ProcessRResponseQueue(std::stop_token stop_token);
+
+  // adds a response's TaskTiming to task_queue_counters_
+  void CountTaskTiming(const RWorker::RResponse& response);
+
+  // submits a task answered from its DONE event into response,
+  // ManagementCodeResult or CppCommandResult. only used in the .cpp
+  template <typename Result>
+  grpc::ServerUnaryReactor* SubmitManagementTask(
+    grpc::CallbackServerContext& context,
+    std::unique_ptr<RWorker::RTask> r_task, Result* response);
+
+  // the request's timeout, or the default if it has none. EvalRScriptRequest
+  // and EvalManagementCodeRequest, only used in the .cpp
+  template <typename Request>
+  std::chrono::milliseconds EvalTimeout(const Request& request) const;
+  // the request's output limits, within the server's. EvalRScriptRequest
+  // and EvalRScriptBatchRequest, only used in the .cpp
+  template <typename Request>
+  RWorker::OutputLimits EvalOutputLimits(const Request& request) const;
 };
@@ -1,4 +1,5 @@
 #include "r_init.h"
+#include "r_eval.h"
 #include "r_worker.h"
 #include <iostream>
 #include <stdexcept>
@@ -68,6 +69,63 @@ public:
 
     r_snippets_.push_back("options(device = \"svglite\")");
 
+    // output handler used for streaming evaluations. every item goes to
+    // harness_emit_output(), which forwards it to the C++ side as evaluate
+    // produces it, keeps it for when the evaluation is interrupted (see
+    // REvaluator::process_r_code) and returns it unchanged, so the evaluate
+    // result is the same as with the default handler
+    r_snippets_.push_back(R"(
+.harness_stream_output_handler <- local({
+  emit <- function(x) .Call("harness_emit_output", x)
+  evaluate::new_output_handler(
+    source = emit, text = emit, graphics = emit,
+    message = emit, warning = emit, error = emit
+  )
+}))");
+
+    // SVG rendering of a recordedplot, returns svgstring()'s character
+    // vector. the device is closed even when replayPlot fails (a plot from
+    // another process that doesn't replay), otherwise every failure in a
+    // long-lived render helper would leave one open until R runs out
+    r_snippets_.push_back(R"(
+.harness_render_svg <- function(plot, reloadable = FALSE) {
+  svg <- svglite::svgstring()
+  tryCatch(grDevices::replayPlot(plot, reloadable = reloadable),
+           finally = grDevices::dev.off())
+  svg()
+})");
+
+    // PNG rendering of a recordedplot for the PNG/AUTO plot formats, returns
+    // the file's bytes as a raw vector. ragg if it is installed (faster,
+    // same output everywhere), the cairo png device otherwise. the file is
+    // per process since render helpers share the R tempdir
+    r_snippets_.push_back(R"(
+.harness_render_png <- local({
+  png_device <- if (requireNamespace("ragg", quietly = TRUE)) {
+    function(file) ragg::agg_png(file, width = 10, height = 8, units = "in", res = 96)
+  } else {
+    function(file) grDevices::png(file, width = 10, height = 8, units = "in", res = 96, type = "cairo")
+  }
+  function(plot, reloadable = FALSE) {
+    file <- tempfile(paste0("harness-plot-", Sys.getpid(), "-"), fileext = ".png")
+    on.exit(unlink(file))
+    png_device(file)
+    tryCatch(grDevices::replayPlot(plot, reloadable = reloadable),
+             finally = grDevices::dev.off())
+    readBin(file, "raw", file.info(file)$size)
+  }
+}))");
+
+    // row order of a table view (GetTable sort keys), columns is a list of
+    // the key columns. radix is stable, much faster than the default on big
+    // data and sorts text by bytes, the same in every locale
+    r_snippets_.push_back(R"(
+.harness_table_order <- function(columns, decreasing) {
+  do.call(order, c(unname(columns),
+                   list(na.last = TRUE, decreasing = decreasing,
+                        method = "radix")))
+})");
+
     r_snippets_.push_back("print(\"setup done!\")");
   }
 
@@ -82,6 +140,9 @@ bool exec_R_setup() {
 
   std::cout << "Starting R setup: exec_R_setup()" << std::endl;
 
+  // native routines first, some snippets define R functions calling them
+  register_r_eval_routines();
+
   RSetup &r_setup = RSetup::getInstance();
 
   // running actual snippets
@@ -89,6 +150,9 @@ bool exec_R_setup() {
     throw std::runtime_error("RSetup snippets failed to run completely");
   }
 
+  // everything evaluate needs is loaded now, resolve it once
+  init_r_eval_handles();
+
   return true;
 }
 
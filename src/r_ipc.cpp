@@ -0,0 +1,641 @@
+#include "r_ipc.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
+#include <climits>
+#include <cstring>
+#include <stdexcept>
+#include <sys/socket.h>
+#include <sys/types.h>
+#include <sys/uio.h>
+#include <type_traits>
+#include <unistd.h>
+#include <vector>
+
+namespace RWorker {
+
+namespace {
+
+// anything bigger is treated as a corrupted stream rather than allocated
+constexpr uint32_t max_frame_payload = 1u << 30;
+
+bool write_all(int fd, const char *data, size_t size) {
+  while (size > 0) {
+    // MSG_NOSIGNAL so a dead peer is an error return instead of SIGPIPE
+    ssize_t written = send(fd, data, size, MSG_NOSIGNAL);
+    if (written < 0) {
+      if (errno == EINTR)
+        continue;
+      return false;
+    }
+    data += written;
+    size -= static_cast<size_t>(written);
+  }
+  return true;
+}
+
+// gather version of write_all, consumes the iovecs as it goes
+bool write_all(int fd, std::vector<iovec> &iovecs) {
+  size_t first = 0;
+  while (first < iovecs.size()) {
+    msghdr message{};
+    message.msg_iov = iovecs.data() + first;
+    message.msg_iovlen = std::min<size_t>(iovecs.size() - first, IOV_MAX);
+
+    ssize_t written = sendmsg(fd, &message, MSG_NOSIGNAL);
+    if (written < 0) {
+      if (errno == EINTR)
+        continue;
+      return false;
+    }
+
+    size_t remaining = static_cast<size_t>(written);
+    while (first < iovecs.size() && remaining >= iovecs[first].iov_len) {
+      remaining -= iovecs[first].iov_len;
+      ++first;
+    }
+    if (remaining > 0) {
+      iovecs[first].iov_base = static_cast<char *>(iovecs[first].iov_base) + remaining;
+      iovecs[first].iov_len -= remaining;
+    }
+  }
+  return true;
+}
+
+bool read_all(int fd, char *data, size_t size) {
+  while (size > 0) {
+    ssize_t got = recv(fd, data, size, 0);
+    if (got < 0) {
+      if (errno == EINTR)
+        continue;
+      return false;
+    }
+    // orderly shutdown by the peer
+    if (got == 0)
+      return false;
+    data += got;
+    size -= static_cast<size_t>(got);
+  }
+  return true;
+}
+
+// strings at least this big are not copied into the writer, see WireWriter
+constexpr size_t min_referenced_string = 64 * 1024;
+
+// builds a payload. strings of min_referenced_string or more are only
+// referenced, so the source has to outlive the writer. take() still copies
+// them in, write_frame_to() hands them to the kernel straight from the source
+class WireWriter {
+public:
+  template <typename T> void put(T value) {
+    static_assert(std::is_trivially_copyable_v<T>);
+    out_.append(reinterpret_cast<const char *>(&value), sizeof(T));
+  }
+
+  void put_string(std::string_view value) {
+    put<uint64_t>(value.size());
+    if (value.size() >= min_referenced_string) {
+      references_.push_back({out_.size(), value});
+      referenced_size_ += value.size();
+    } else {
+      out_.append(value);
+    }
+  }
+
+  // one string, given as consecutive pieces. the reader sees a plain string
+  void put_string_pieces(const std::vector<std::string_view> &pieces) {
+    uint64_t size = 0;
+    for (std::string_view piece : pieces) {
+      size += piece.size();
+    }
+    put<uint64_t>(size);
+    for (std::string_view piece : pieces) {
+      if (piece.size() >= min_referenced_string) {
+        references_.push_back({out_.size(), piece});
+        referenced_size_ += piece.size();
+      } else {
+        out_.append(piece);
+      }
+    }
+  }
+
+  void put_strings(const std::vector<std::string> &values) {
+    put<uint64_t>(values.size());
+    for (const std::string &value : values) {
+      put_string(value);
+    }
+  }
+
+  std::string take() {
+    if (references_.empty()) {
+      return std::move(out_);
+    }
+
+    std::string payload;
+    payload.reserve(out_.size() + referenced_size_);
+    size_t copied = 0;
+    for (const Reference &reference : references_) {
+      payload.append(out_, copied, reference.offset - copied);
+      payload.append(reference.data);
+      copied = reference.offset;
+    }
+    payload.append(out_, copied);
+    return payload;
+  }
+
+  // of the payload take() would return
+  size_t size() const { return out_.size() + referenced_size_; }
+
+  bool write_frame_to(int fd, FrameType type) {
+    size_t payload_size = size();
+    if (payload_size > max_frame_payload) {
+      return false;
+    }
+
+    char header[sizeof(uint32_t) + sizeof(uint8_t)];
+    uint32_t length = static_cast<uint32_t>(payload_size);
+    std::memcpy(header, &length, sizeof(length));
+    header[sizeof(length)] = static_cast<char>(type);
+
+    std::vector<iovec> iovecs;
+    iovecs.reserve(2 * references_.size() + 2);
+    iovecs.push_back({header, sizeof(header)});
+    size_t written = 0;
+    for (const Reference &reference : references_) {
+      if (reference.offset > written) {
+        iovecs.push_back({out_.data() + written, reference.offset - written});
+      }
+      iovecs.push_back({const_cast<char *>(reference.data.data()),
+                        reference.data.size()});
+      written = reference.offset;
+    }
+    if (out_.size() > written) {
+      iovecs.push_back({out_.data() + written, out_.size() - written});
+    }
+    return write_all(fd, iovecs);
+  }
+
+private:
+  struct Reference {
+    // where in out_ the string goes
+    size_t offset;
+    std::string_view data;
+  };
+
+  std::string out_;
+  std::vector<Reference> references_;
+  size_t referenced_size_ = 0;
+};
+
+class WireReader {
+public:
+  explicit WireReader(std::string_view in) : in_(in) {}
+
+  template <typename T> T get() {
+    static_assert(std::is_trivially_copyable_v<T>);
+    need(sizeof(T));
+    T value;
+    std::memcpy(&value, in_.data(), sizeof(T));
+    in_.remove_prefix(sizeof(T));
+    return value;
+  }
+
+  std::string get_string() { return std::string(get_string_view()); }
+
+  // points into the input, which has to outlive the view
+  std::string_view get_string_view() {
+    uint64_t size = get<uint64_t>();
+    need(size);
+    std::string_view value = in_.substr(0, size);
+    in_.remove_prefix(size);
+    return value;
+  }
+
+  std::vector<std::string> get_strings() {
+    uint64_t count = get<uint64_t>();
+    std::vector<std::string> values;
+    values.reserve(std::min<uint64_t>(count, in_.size()));
+    for (uint64_t i = 0; i < count; ++i) {
+      values.push_back(get_string());
+    }
+    return values;
+  }
+
+private:
+  void need(uint64_t size) const {
+    if (size > in_.size()) {
+      throw std::runtime_error("IPC payload truncated");
+    }
+  }
+
+  std::string_view in_;
+};
+
+// shared by serialize_response and write_response_frame
+void put_response(WireWriter &writer, const RResponse &response) {
+  writer.put_string(response.get_task_uuid());
+  writer.put<uint8_t>(static_cast<uint8_t>(response.get_status()));
+
+  writer.put<uint8_t>(response.get_error_message().has_value() ? 1 : 0);
+  if (response.get_error_message().has_value()) {
+    writer.put_string(response.get_error_message().value());
+  }
+
+  const TaskTiming &timing = response.get_timing();
+  writer.put<uint8_t>(static_cast<uint8_t>(timing.task_class));
+  writer.put<int64_t>(timing.queue_wait.count());
+  writer.put<int64_t>(timing.run_time.count());
+  writer.put<uint8_t>(timing.finished_past_deadline ? 1 : 0);
+  writer.put<uint8_t>(static_cast<uint8_t>(response.get_task_type()));
+
+  writer.put<uint8_t>(
+      static_cast<uint8_t>(response.get_result_payload().index()));
+  std::visit(
+      [&writer](const auto &payload) {
+        using T = std::decay_t<decltype(payload)>;
+        if constexpr (std::is_same_v<T, RClientOutputPayload>) {
+          writer.put_strings(payload.console_output);
+          writer.put<uint64_t>(payload.graphic_output.size());
+          for (const PlotOutput &plot : payload.graphic_output) {
+            writer.put<uint8_t>(static_cast<uint8_t>(plot.format));
+            writer.put_string(plot.data);
+          }
+          writer.put<uint8_t>(static_cast<uint8_t>(payload.plot_policy));
+          const ConsoleOutputSizes &sizes = payload.console_sizes;
+          writer.put<uint64_t>(sizes.total_lines);
+          writer.put<uint64_t>(sizes.total_bytes);
+          writer.put<uint64_t>(sizes.retained_lines);
+          writer.put<uint64_t>(sizes.retained_bytes);
+          writer.put<uint8_t>(sizes.truncated ? 1 : 0);
+          writer.put<uint64_t>(payload.snippets.size());
+          for (const SnippetResult &snippet : payload.snippets) {
+            writer.put<uint8_t>(static_cast<uint8_t>(snippet.status));
+            writer.put<uint64_t>(snippet.first_line);
+            writer.put<uint64_t>(snippet.num_lines);
+            writer.put<uint64_t>(snippet.first_plot);
+            writer.put<uint64_t>(snippet.num_plots);
+            writer.put<uint64_t>(snippet.console_sizes.total_lines);
+            writer.put<uint64_t>(snippet.console_sizes.total_bytes);
+            writer.put<uint64_t>(snippet.console_sizes.retained_lines);
+            writer.put<uint64_t>(snippet.console_sizes.retained_bytes);
+            writer.put<uint8_t>(snippet.console_sizes.truncated ? 1 : 0);
+            writer.put<int64_t>(snippet.run_time.count());
+          }
+        } else if constexpr (std::is_same_v<T, ManagementTaskResultPayload>) {
+          writer.put_string(payload.result_message);
+        }
+      },
+      response.get_result_payload());
+}
+
+} // namespace
+
+bool write_frame(int fd, FrameType type, std::string_view payload) {
+  if (payload.size() > max_frame_payload) {
+    return false;
+  }
+
+  char header[sizeof(uint32_t) + sizeof(uint8_t)];
+  uint32_t length = static_cast<uint32_t>(payload.size());
+  std::memcpy(header, &length, sizeof(length));
+  header[sizeof(length)] = static_cast<char>(type);
+
+  return write_all(fd, header, sizeof(header)) &&
+         write_all(fd, payload.data(), payload.size());
+}
+
+bool read_frame(int fd, Frame &frame) {
+  char header[sizeof(uint32_t) + sizeof(uint8_t)];
+  if (!read_all(fd, header, sizeof(header))) {
+    return false;
+  }
+
+  uint32_t length;
+  std::memcpy(&length, header, sizeof(length));
+  if (length > max_frame_payload) {
+    return false;
+  }
+
+  frame.type = static_cast<FrameType>(header[sizeof(length)]);
+  frame.payload.resize(length);
+  return read_all(fd, frame.payload.data(), length);
+}
+
+std::string serialize_task(const RTask &task) {
+  WireWriter writer;
+  writer.put_string(task.get_uuid());
+  writer.put<uint8_t>(static_cast<uint8_t>(task.get_type()));
+  writer.put_string(task.get_session_id());
+  writer.put<uint8_t>(static_cast<uint8_t>(task.get_task_class()));
+  writer.put_string(task.get_client_id());
+  writer.put<uint32_t>(task.get_client_weight());
+  writer.put<uint8_t>(task.get_event_sink() ? 1 : 0);
+  writer.put<int64_t>(task.get_created_at().time_since_epoch().count());
+  writer.put<uint8_t>(task.get_client_deadline().has_value() ? 1 : 0);
+  if (task.get_client_deadline().has_value()) {
+    writer.put<int64_t>(
+        task.get_client_deadline()->time_since_epoch().count());
+  }
+
+  writer.put<uint8_t>(static_cast<uint8_t>(task.get_data().index()));
+  std::visit(
+      [&writer](const auto &payload) {
+        using T = std::decay_t<decltype(payload)>;
+        if constexpr (std::is_same_v<T, RCodePayload>) {
+          writer.put_string(payload.code);
+          writer.put<uint8_t>(static_cast<uint8_t>(payload.plot_policy));
+          writer.put<int64_t>(payload.timeout.count());
+          writer.put<uint64_t>(payload.output_limits.max_lines);
+          writer.put<uint64_t>(payload.output_limits.max_bytes);
+        } else if constexpr (std::is_same_v<T, CppManagementPayload>) {
+          writer.put_string(payload.command_identifier);
+          writer.put_strings(payload.arguments);
+        } else if constexpr (std::is_same_v<T, TableViewPayload>) {
+          writer.put_string(payload.variable);
+          writer.put<uint64_t>(payload.offset);
+          writer.put<uint64_t>(payload.max_rows);
+          writer.put<uint64_t>(payload.batch_rows);
+          writer.put<uint64_t>(payload.sort.size());
+          for (const TableSortKey &key : payload.sort) {
+            writer.put_string(key.column);
+            writer.put<uint8_t>(key.descending ? 1 : 0);
+          }
+          writer.put<uint64_t>(payload.filters.size());
+          for (const TableFilter &filter : payload.filters) {
+            writer.put_string(filter.column);
+            writer.put<uint8_t>(static_cast<uint8_t>(filter.op));
+            writer.put_string(filter.value);
+          }
+        } else if constexpr (std::is_same_v<T, RCodeBatchPayload>) {
+          writer.put_strings(payload.snippets);
+          writer.put<uint8_t>(payload.stop_on_error ? 1 : 0);
+          writer.put<uint8_t>(static_cast<uint8_t>(payload.plot_policy));
+          writer.put<int64_t>(payload.timeout.count());
+          writer.put<uint64_t>(payload.output_limits.max_lines);
+          writer.put<uint64_t>(payload.output_limits.max_bytes);
+        }
+      },
+      task.get_data());
+
+  return writer.take();
+}
+
+std::unique_ptr<RTask> deserialize_task(std::string_view bytes,
+                                        bool &wants_events) {
+  WireReader reader(bytes);
+  std::string uuid = reader.get_string();
+  TaskType type = static_cast<TaskType>(reader.get<uint8_t>());
+  std::string session_id = reader.get_string();
+  auto task_class = static_cast<TaskClass>(reader.get<uint8_t>());
+  std::string client_id = reader.get_string();
+  auto client_weight = reader.get<uint32_t>();
+  wants_events = reader.get<uint8_t>() != 0;
+  std::chrono::steady_clock::time_point created_at(
+      std::chrono::steady_clock::duration(reader.get<int64_t>()));
+  std::optional<std::chrono::steady_clock::time_point> client_deadline;
+  if (reader.get<uint8_t>() != 0) {
+    client_deadline = std::chrono::steady_clock::time_point(
+        std::chrono::steady_clock::duration(reader.get<int64_t>()));
+  }
+
+  TaskData data;
+  switch (reader.get<uint8_t>()) {
+  case 0: {
+    std::string code = reader.get_string();
+    auto plot_policy = static_cast<PlotFormatPolicy>(reader.get<uint8_t>());
+    std::chrono::milliseconds timeout(reader.get<int64_t>());
+    OutputLimits output_limits;
+    output_limits.max_lines = reader.get<uint64_t>();
+    output_limits.max_bytes = reader.get<uint64_t>();
+    data = RCodePayload{std::move(code), plot_policy, timeout, output_limits};
+    break;
+  }
+  case 1: {
+    std::string command_identifier = reader.get_string();
+    data = CppManagementPayload{std::move(command_identifier),
+                                reader.get_strings()};
+    break;
+  }
+  case 2: {
+    TableViewPayload table_view;
+    table_view.variable = reader.get_string();
+    table_view.offset = reader.get<uint64_t>();
+    table_view.max_rows = reader.get<uint64_t>();
+    table_view.batch_rows = reader.get<uint64_t>();
+    uint64_t num_sort_keys = reader.get<uint64_t>();
+    for (uint64_t i = 0; i < num_sort_keys; ++i) {
+      TableSortKey key;
+      key.column = reader.get_string();
+      key.descending = reader.get<uint8_t>() != 0;
+      table_view.sort.push_back(std::move(key));
+    }
+    uint64_t num_filters = reader.get<uint64_t>();
+    for (uint64_t i = 0; i < num_filters; ++i) {
+      TableFilter filter;
+      filter.column = reader.get_string();
+      filter.op = static_cast<TableFilterOp>(reader.get<uint8_t>());
+      filter.value = reader.get_string();
+      table_view.filters.push_back(std::move(filter));
+    }
+    data = std::move(table_view);
+    break;
+  }
+  case 3: {
+    RCodeBatchPayload batch;
+    batch.snippets = reader.get_strings();
+    batch.stop_on_error = reader.get<uint8_t>() != 0;
+    batch.plot_policy = static_cast<PlotFormatPolicy>(reader.get<uint8_t>());
+    batch.timeout = std::chrono::milliseconds(reader.get<int64_t>());
+    batch.output_limits.max_lines = reader.get<uint64_t>();
+    batch.output_limits.max_bytes = reader.get<uint64_t>();
+    data = std::move(batch);
+    break;
+  }
+  default:
+    throw std::runtime_error("IPC task has unknown payload type");
+  }
+
+  std::unique_ptr<RTask> task =
+      RTask::restore_task(std::move(uuid), type, std::move(data), created_at);
+  task->set_session_id(std::move(session_id));
+  task->set_task_class(task_class);
+  task->set_client(std::move(client_id), client_weight);
+  task->set_client_deadline(client_deadline);
+  return task;
+}
+
+std::string serialize_response(const RResponse &response) {
+  WireWriter writer;
+  put_response(writer, response);
+  return writer.take();
+}
+
+bool write_response_frame(int fd, const RResponse &response) {
+  WireWriter writer;
+  put_response(writer, response);
+  return writer.write_frame_to(fd, FrameType::RESPONSE);
+}
+
+bool response_fits_frame(const RResponse &response) {
+  WireWriter writer;
+  put_response(writer, response);
+  return writer.size() <= max_frame_payload;
+}
+
+std::unique_ptr<RResponse> deserialize_response(std::string_view bytes) {
+  WireReader reader(bytes);
+  std::string task_uuid = reader.get_string();
+  ResponseStatus status = static_cast<ResponseStatus>(reader.get<uint8_t>());
+
+  std::optional<std::string> error_message;
+  if (reader.get<uint8_t>() != 0) {
+    error_message = reader.get_string();
+  }
+
+  TaskTiming timing;
+  timing.task_class = static_cast<TaskClass>(reader.get<uint8_t>());
+  timing.queue_wait = std::chrono::microseconds(reader.get<int64_t>());
+  timing.run_time = std::chrono::microseconds(reader.get<int64_t>());
+  timing.finished_past_deadline = reader.get<uint8_t>() != 0;
+  auto task_type = static_cast<TaskType>(reader.get<uint8_t>());
+
+  ResultData payload;
+  switch (reader.get<uint8_t>()) {
+  case 0:
+    break;
+  case 1: {
+    RClientOutputPayload client_output;
+    client_output.console_output = reader.get_strings();
+    uint64_t num_plots = reader.get<uint64_t>();
+    for (uint64_t i = 0; i < num_plots; ++i) {
+      PlotOutput plot;
+      plot.format = static_cast<PlotFormat>(reader.get<uint8_t>());
+      plot.data = reader.get_string();
+      client_output.graphic_output.push_back(std::move(plot));
+    }
+    client_output.plot_policy =
+        static_cast<PlotFormatPolicy>(reader.get<uint8_t>());
+    ConsoleOutputSizes &sizes = client_output.console_sizes;
+    sizes.total_lines = reader.get<uint64_t>();
+    sizes.total_bytes = reader.get<uint64_t>();
+    sizes.retained_lines = reader.get<uint64_t>();
+    sizes.retained_bytes = reader.get<uint64_t>();
+    sizes.truncated = reader.get<uint8_t>() != 0;
+    uint64_t num_snippets = reader.get<uint64_t>();
+    for (uint64_t i = 0; i < num_snippets; ++i) {
+      SnippetResult snippet;
+      snippet.status = static_cast<ResponseStatus>(reader.get<uint8_t>());
+      snippet.first_line = reader.get<uint64_t>();
+      snippet.num_lines = reader.get<uint64_t>();
+      snippet.first_plot = reader.get<uint64_t>();
+      snippet.num_plots = reader.get<uint64_t>();
+      snippet.console_sizes.total_lines = reader.get<uint64_t>();
+      snippet.console_sizes.total_bytes = reader.get<uint64_t>();
+      snippet.console_sizes.retained_lines = reader.get<uint64_t>();
+      snippet.console_sizes.retained_bytes = reader.get<uint64_t>();
+      snippet.console_sizes.truncated = reader.get<uint8_t>() != 0;
+      snippet.run_time = std::chrono::microseconds(reader.get<int64_t>());
+      client_output.snippets.push_back(snippet);
+    }
+    payload = std::move(client_output);
+    break;
+  }
+  case 2: {
+    payload = ManagementTaskResultPayload{reader.get_string()};
+    break;
+  }
+  default:
+    throw std::runtime_error("IPC response has unknown payload type");
+  }
+
+  auto response = std::make_unique<RResponse>(
+      std::move(task_uuid), status, std::move(payload),
+      std::move(error_message));
+  response->set_timing(timing);
+  response->set_task_type(task_type);
+  return response;
+}
+
+std::string serialize_output_event(const std::string &task_uuid,
+                                   const OutputEvent &event) {
+  WireWriter writer;
+  writer.put_string(task_uuid);
+  writer.put<uint8_t>(static_cast<uint8_t>(event.type));
+  writer.put<uint8_t>(static_cast<uint8_t>(event.status));
+  writer.put<uint8_t>(static_cast<uint8_t>(event.plot_format));
+  writer.put_string(event.content);
+  return writer.take();
+}
+
+bool write_output_event_frame(int fd, const std::string &task_uuid,
+                              OutputEventType type,
+                              const std::vector<std::string_view> &content) {
+  WireWriter writer;
+  writer.put_string(task_uuid);
+  writer.put<uint8_t>(static_cast<uint8_t>(type));
+  writer.put<uint8_t>(static_cast<uint8_t>(ResponseStatus::SUCCESS));
+  writer.put<uint8_t>(static_cast<uint8_t>(PlotFormat::SVG));
+  writer.put_string_pieces(content);
+  return writer.write_frame_to(fd, FrameType::OUTPUT_EVENT);
+}
+
+OutputEvent deserialize_output_event(std::string_view bytes,
+                                     std::string &task_uuid) {
+  WireReader reader(bytes);
+  task_uuid = reader.get_string();
+
+  OutputEvent event;
+  event.type = static_cast<OutputEventType>(reader.get<uint8_t>());
+  event.status = static_cast<ResponseStatus>(reader.get<uint8_t>());
+  event.plot_format = static_cast<PlotFormat>(reader.get<uint8_t>());
+  event.content = reader.get_string();
+  return event;
+}
+
+std::string serialize_credit(const std::string &task_uuid, uint64_t bytes) {
+  WireWriter writer;
+  writer.put_string(task_uuid);
+  writer.put<uint64_t>(bytes);
+  return writer.take();
+}
+
+uint64_t deserialize_credit(std::string_view bytes, std::string &task_uuid) {
+  WireReader reader(bytes);
+  task_uuid = reader.get_string();
+  return reader.get<uint64_t>();
+}
+
+bool write_plot_render_frame(int fd, PlotFormatPolicy policy,
+                             std::string_view serialized_plot) {
+  WireWriter writer;
+  writer.put<uint8_t>(static_cast<uint8_t>(policy));
+  writer.put_string(serialized_plot);
+  return writer.write_frame_to(fd, FrameType::PLOT_RENDER);
+}
+
+std::string_view deserialize_plot_render_request(std::string_view bytes,
+                                                 PlotFormatPolicy &policy) {
+  WireReader reader(bytes);
+  policy = static_cast<PlotFormatPolicy>(reader.get<uint8_t>());
+  return reader.get_string_view();
+}
+
+bool write_plot_render_result_frame(int fd, const PlotRenderResult &result) {
+  WireWriter writer;
+  writer.put<uint8_t>(result.ok ? 1 : 0);
+  writer.put<uint8_t>(static_cast<uint8_t>(result.format));
+  writer.put_string(result.content);
+  return writer.write_frame_to(fd, FrameType::PLOT_RENDERED);
+}
+
+PlotRenderResult deserialize_plot_render_result(std::string_view bytes) {
+  WireReader reader(bytes);
+  PlotRenderResult result;
+  result.ok = reader.get<uint8_t>() != 0;
+  result.format = static_cast<PlotFormat>(reader.get<uint8_t>());
+  result.content = reader.get_string();
+  return result;
+}
+
+} // namespace RWorker
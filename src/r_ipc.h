@@ -0,0 +1,108 @@
+#pragma once
+
+#include "r_result.h"
+#include "r_task.h"
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+// wire format between the gRPC front-end process and the R worker processes
+//
+// RTask and RResponse are the contract, this just flattens them. everything
+// goes over a unix stream socket as frames:
+//   [u32 payload length][u8 frame type][payload]
+// integers are in host byte order, both ends are always the same binary on
+// the same machine (the workers are forked from the front-end, through the
+// zygote).
+
+namespace RWorker {
+
+enum class FrameType : uint8_t {
+  // front-end -> worker
+  TASK = 1,
+  // worker -> front-end
+  RESPONSE = 2,
+  OUTPUT_EVENT = 3,
+  // front-end -> zygote, empty payload (see r_zygote.h)
+  SPAWN_WORKER = 4,
+  // worker -> render helper (see r_plot_render.h)
+  PLOT_RENDER = 5,
+  // render helper -> worker
+  PLOT_RENDERED = 6,
+  // front-end -> worker, payload is the uuid of the task to stop (see
+  // r_task_control.h)
+  CANCEL = 7,
+  // front-end -> worker, payload is the uuid of a task whose client went
+  // away. dropped if it is still queued, left alone if it is running
+  ABANDON = 8,
+  // front-end -> worker, the client of a VIEW_TABLE task read more of its
+  // stream (serialize_credit), see table_stream_window_bytes
+  CREDIT = 9,
+};
+
+// how far a VIEW_TABLE task's stream may run ahead of what the front-end has
+// written to the client. the front-end gives the bytes back with CREDIT
+// frames as it writes them, and the worker waits for them once the window
+// is used up (RTaskControl::wait_for_credit)
+constexpr uint64_t table_stream_window_bytes = 4 * 1024 * 1024;
+
+struct Frame {
+  FrameType type;
+  std::string payload;
+};
+
+// both return false if the socket was closed or errored, they do not throw.
+// a frame is written with several syscalls, so anyone sharing a socket
+// between threads needs to hold a lock around write_frame
+bool write_frame(int fd, FrameType type, std::string_view payload);
+bool read_frame(int fd, Frame &frame);
+
+// the deserialize functions throw std::runtime_error on malformed input
+std::string serialize_task(const RTask &task);
+// an event sink can't cross the process boundary, only a flag that one was
+// attached does. it ends up in wants_events, the worker side then attaches its
+// own sink that forwards OUTPUT_EVENT frames
+std::unique_ptr<RTask> deserialize_task(std::string_view bytes,
+                                        bool &wants_events);
+
+std::string serialize_response(const RResponse &response);
+// same frame as write_frame(fd, RESPONSE, serialize_response(response)), but
+// big strings (plots) go to the socket straight out of the response with one
+// gather write instead of being copied into a payload buffer first
+bool write_response_frame(int fd, const RResponse &response);
+std::unique_ptr<RResponse> deserialize_response(std::string_view bytes);
+// false if the response is too big for one frame, write_response_frame()
+// would fail on it without writing anything. computed without copying the
+// big strings
+bool response_fits_frame(const RResponse &response);
+
+std::string serialize_output_event(const std::string &task_uuid,
+                                   const OutputEvent &event);
+// OUTPUT_EVENT frame of a data event (OutputEventSink::push_data_event()),
+// the content pieces go out with one gather write, not copied together
+bool write_output_event_frame(int fd, const std::string &task_uuid,
+                              OutputEventType type,
+                              const std::vector<std::string_view> &content);
+// fills task_uuid with the uuid of the task the event belongs to
+OutputEvent deserialize_output_event(std::string_view bytes,
+                                     std::string &task_uuid);
+
+// CREDIT frame payload
+std::string serialize_credit(const std::string &task_uuid, uint64_t bytes);
+// fills task_uuid with the uuid of the task the credit is for
+uint64_t deserialize_credit(std::string_view bytes, std::string &task_uuid);
+
+// PLOT_RENDER and PLOT_RENDERED frames, written with gather writes like
+// write_response_frame() since plots are big
+bool write_plot_render_frame(int fd, PlotFormatPolicy policy,
+                             std::string_view serialized_plot);
+// the returned view points into bytes
+std::string_view deserialize_plot_render_request(std::string_view bytes,
+                                                 PlotFormatPolicy &policy);
+bool write_plot_render_result_frame(int fd, const PlotRenderResult &result);
+PlotRenderResult deserialize_plot_render_result(std::string_view bytes);
+
+} // namespace RWorker
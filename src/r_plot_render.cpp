@@ -0,0 +1,248 @@
+#include "r_plot_render.h"
+#include "r_eval.h"
+#include "r_ipc.h"
+
+#include <cerrno>
+#include <csignal>
+#include <cstring>
+#include <exception>
+#include <iostream>
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#include <utility>
+
+namespace RWorker {
+
+PlotRenderPool::PlotRenderPool(std::size_t num_helpers,
+                               const std::vector<int> &close_in_helpers) {
+  for (std::size_t i = 0; i < num_helpers; ++i) {
+    int fds[2];
+    if (socketpair(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0, fds) != 0) {
+      std::cerr << "R worker " << getpid()
+                << ": socketpair() for a render helper failed: "
+                << std::strerror(errno) << std::endl;
+      break;
+    }
+
+    pid_t pid = fork();
+    if (pid < 0) {
+      std::cerr << "R worker " << getpid()
+                << ": fork() of a render helper failed: "
+                << std::strerror(errno) << std::endl;
+      close(fds[0]);
+      close(fds[1]);
+      break;
+    }
+
+    if (pid == 0) {
+      // helper: keep nothing of the worker's but R and our own socket
+      close(fds[0]);
+      for (int fd : close_in_helpers) {
+        close(fd);
+      }
+      for (const Helper &sibling : helpers_) {
+        close(sibling.socket_fd);
+      }
+      run_plot_render_helper(fds[1]);
+    }
+
+    close(fds[1]);
+    Helper helper;
+    helper.pid = pid;
+    helper.socket_fd = fds[0];
+    helpers_.push_back(helper);
+  }
+}
+
+PlotRenderPool::~PlotRenderPool() {
+  for (Helper &helper : helpers_) {
+    if (helper.alive) {
+      close(helper.socket_fd);
+      waitpid(helper.pid, nullptr, 0);
+    }
+  }
+}
+
+std::size_t PlotRenderPool::num_helpers() const {
+  std::size_t alive = 0;
+  for (const Helper &helper : helpers_) {
+    if (helper.alive) {
+      ++alive;
+    }
+  }
+  return alive;
+}
+
+void PlotRenderPool::begin_batch() {
+  queued_.clear();
+  outstanding_ = 0;
+  for (const Helper &helper : helpers_) {
+    if (helper.alive && helper.rendering.has_value()) {
+      ++outstanding_;
+    }
+  }
+  // results of the old batch are thrown away as they come in
+  while (outstanding_ > 0 && num_helpers() > 0) {
+    read_results(true);
+  }
+
+  plots_.clear();
+  policies_.clear();
+  results_.clear();
+  outstanding_ = 0;
+}
+
+std::size_t PlotRenderPool::submit(std::string serialized_plot,
+                                   PlotFormatPolicy policy) {
+  std::size_t index = plots_.size();
+  plots_.push_back(std::move(serialized_plot));
+  policies_.push_back(policy);
+  results_.emplace_back();
+  queued_.push_back(index);
+  ++outstanding_;
+
+  // pick up whatever finished meanwhile so those helpers take the new plot
+  read_results(false);
+  dispatch();
+  return index;
+}
+
+std::vector<std::optional<PlotRenderResult>> PlotRenderPool::collect() {
+  dispatch();
+  while (outstanding_ > 0) {
+    if (num_helpers() == 0) {
+      // every helper is gone, the caller renders what is left
+      outstanding_ -= queued_.size();
+      queued_.clear();
+      break;
+    }
+    read_results(true);
+    dispatch();
+  }
+
+  plots_.clear();
+  policies_.clear();
+  outstanding_ = 0;
+  return std::exchange(results_, {});
+}
+
+void PlotRenderPool::dispatch() {
+  for (Helper &helper : helpers_) {
+    if (queued_.empty()) {
+      return;
+    }
+    if (!helper.alive || helper.rendering.has_value()) {
+      continue;
+    }
+
+    std::size_t index = queued_.front();
+    if (!write_plot_render_frame(helper.socket_fd, policies_[index],
+                                 plots_[index])) {
+      helper_died(helper);
+      continue;
+    }
+    queued_.pop_front();
+    helper.rendering = index;
+    std::string().swap(plots_[index]);
+  }
+}
+
+void PlotRenderPool::read_results(bool block) {
+  std::vector<pollfd> poll_fds;
+  std::vector<Helper *> polled;
+  for (Helper &helper : helpers_) {
+    if (helper.alive && helper.rendering.has_value()) {
+      poll_fds.push_back({helper.socket_fd, POLLIN, 0});
+      polled.push_back(&helper);
+    }
+  }
+  if (poll_fds.empty()) {
+    return;
+  }
+
+  int ready = poll(poll_fds.data(), poll_fds.size(), block ? -1 : 0);
+  if (ready <= 0) {
+    // EINTR or nothing ready yet, callers loop
+    return;
+  }
+
+  for (std::size_t i = 0; i < poll_fds.size(); ++i) {
+    if (poll_fds[i].revents == 0) {
+      continue;
+    }
+    Helper &helper = *polled[i];
+
+    Frame frame;
+    if (!read_frame(helper.socket_fd, frame) ||
+        frame.type != FrameType::PLOT_RENDERED) {
+      helper_died(helper);
+      continue;
+    }
+
+    std::size_t index = helper.rendering.value();
+    helper.rendering.reset();
+    --outstanding_;
+    try {
+      if (index < results_.size()) {
+        results_[index] = deserialize_plot_render_result(frame.payload);
+      }
+    } catch (const std::exception &e) {
+      std::cerr << "R worker " << getpid()
+                << ": malformed render result: " << e.what() << std::endl;
+    }
+  }
+}
+
+void PlotRenderPool::helper_died(Helper &helper) {
+  std::cerr << "R worker " << getpid() << ": render helper " << helper.pid
+            << " is gone, rendering its plots inline from now on"
+            << std::endl;
+
+  helper.alive = false;
+  close(helper.socket_fd);
+  kill(helper.pid, SIGKILL);
+  waitpid(helper.pid, nullptr, 0);
+
+  // its plot stays without a result, collect() hands that back as empty
+  if (helper.rendering.has_value()) {
+    helper.rendering.reset();
+    --outstanding_;
+  }
+}
+
+void run_plot_render_helper(int socket_fd) {
+  Frame frame;
+  while (read_frame(socket_fd, frame)) {
+    if (frame.type != FrameType::PLOT_RENDER) {
+      std::cerr << "render helper " << getpid() << ": unexpected frame type "
+                << static_cast<int>(frame.type) << std::endl;
+      continue;
+    }
+
+    PlotRenderResult result;
+    try {
+      PlotFormatPolicy policy;
+      std::string_view serialized_plot =
+          deserialize_plot_render_request(frame.payload, policy);
+      PlotOutput plot = render_serialized_plot(serialized_plot, policy);
+      result.ok = true;
+      result.format = plot.format;
+      result.content = std::move(plot.data);
+    } catch (const std::exception &e) {
+      result.ok = false;
+      result.content = e.what();
+    }
+
+    if (!write_plot_render_result_frame(socket_fd, result)) {
+      break;
+    }
+  }
+
+  // worker is gone. same as the worker itself, no R cleanup, the R tempdir
+  // is shared
+  _exit(0);
+}
+
+} // namespace RWorker
@@ -0,0 +1,94 @@
+#pragma once
+
+#include "r_result.h"
+
+#include <cstddef>
+#include <deque>
+#include <optional>
+#include <string>
+#include <sys/types.h>
+#include <vector>
+
+// render helper processes of an R worker
+//
+// turning a recordedplot into SVG (svglite + replayPlot) is the slow part of
+// most plotting snippets, and used to run inline on the worker's one R thread,
+// one plot after the other. instead each worker forks a few render helpers
+// when it starts, copies of itself with the same warm R. the worker serializes
+// every recordedplot evaluate() returns and hands it to an idle helper, the
+// helpers render in parallel and send the SVG/PNG back. a helper renders one
+// plot at a time, the rest wait in the pool.
+//
+// helpers talk to their worker with the frames from r_ipc.h over a unix
+// socket, PLOT_RENDER there and PLOT_RENDERED back. a helper exits when its
+// worker closes the socket (or dies). a helper that dies is not replaced, the
+// worker has threads by then and can't fork safely, its plots are rendered
+// inline by the worker again.
+
+namespace RWorker {
+
+class PlotRenderPool {
+public:
+  // forks num_helpers helpers. the calling process must not have started any
+  // threads yet. close_in_helpers are fds the helpers must not keep open, e.g.
+  // the worker's socket to the front-end, so that the front-end still sees
+  // EOF when the worker dies
+  PlotRenderPool(std::size_t num_helpers,
+                 const std::vector<int> &close_in_helpers);
+  // closes the sockets, which makes the helpers exit
+  ~PlotRenderPool();
+
+  PlotRenderPool(const PlotRenderPool &) = delete;
+  PlotRenderPool &operator=(const PlotRenderPool &) = delete;
+
+  // helpers that are still alive
+  std::size_t num_helpers() const;
+
+  // everything below is called from the worker's R thread only, one
+  // evaluation's plots make up a batch
+
+  // drops whatever is left of a batch that was never collected (the
+  // evaluation bailed out half way), waiting for helpers still rendering
+  void begin_batch();
+  // queues a serialized recordedplot (see serialize_recorded_plot()) to be
+  // rendered under policy and returns its index in the batch. sent to a
+  // helper right away if one is idle
+  std::size_t submit(std::string serialized_plot, PlotFormatPolicy policy);
+  // blocks until every plot of the batch is rendered, results in submit
+  // order. empty optional for a plot whose helper died before answering, the
+  // caller renders those itself
+  std::vector<std::optional<PlotRenderResult>> collect();
+
+private:
+  struct Helper {
+    pid_t pid = -1;
+    int socket_fd = -1;
+    bool alive = true;
+    // batch index of the plot it is rendering
+    std::optional<std::size_t> rendering;
+  };
+
+  // sends queued plots to idle helpers
+  void dispatch();
+  // reads finished renders, blocks for at least one if block is set and
+  // something is being rendered
+  void read_results(bool block);
+  void helper_died(Helper &helper);
+
+  std::vector<Helper> helpers_;
+
+  // serialized plots of the batch by index, freed once sent
+  std::vector<std::string> plots_;
+  std::vector<PlotFormatPolicy> policies_;
+  std::vector<std::optional<PlotRenderResult>> results_;
+  // indices not sent to a helper yet
+  std::deque<std::size_t> queued_;
+  // submitted, neither rendered nor given up on
+  std::size_t outstanding_ = 0;
+};
+
+// main of a render helper process, R has to be initialized (it is inherited
+// from the worker)
+[[noreturn]] void run_plot_render_helper(int socket_fd);
+
+} // namespace RWorker
@@ -50,6 +50,15 @@ std::ostream &operator<<(std::ostream &os, const RResponse &response) {
   case ResponseStatus::FAILURE_INVALID_TASK:
     os << "FAILURE_INVALID_TASK"; //
     break;
+  case ResponseStatus::CANCELLED:
+    os << "CANCELLED"; //
+    break;
+  case ResponseStatus::EXPIRED:
+    os << "EXPIRED"; //
+    break;
+  case ResponseStatus::SKIPPED:
+    os << "SKIPPED"; //
+    break;
   default:
     os << "UNKNOWN_RESPONSE_STATUS (value: "
        << static_cast<int>(response.get_status()) << ")"; //
@@ -79,16 +88,21 @@ std::ostream &operator<<(std::ostream &os, const RResponse &response) {
           }
           os << "      ]" << std::endl;
           os << "      Graphic Output: [" << std::endl;
-          for (const auto &svg_data : payload.graphic_output) { //
+          for (const auto &plot : payload.graphic_output) { //
             // Print a placeholder or summary for graphic data to avoid overly
             // long output.
-            os << "        SVG Data (size: " << svg_data.length() << " bytes)"
+            os << "        "
+               << (plot.format == PlotFormat::PNG ? "PNG" : "SVG")
+               << " Data (size: " << plot.data.length() << " bytes)"
                << std::endl;
             // Alternatively, print a snippet:
             // os << "        \"" << svg_data.substr(0, 50) <<
             // (svg_data.length() > 50 ? "..." : "") << "\"" << std::endl;
           }
           os << "      ]" << std::endl;
+          if (!payload.snippets.empty()) {
+            os << "      Snippets: " << payload.snippets.size() << std::endl;
+          }
           os << "    }" << std::endl;
         } else if constexpr (std::is_same_v<T,
                                             ManagementTaskResultPayload>) { //
@@ -130,6 +144,15 @@ std::ostream &operator<<(std::ostream &os, const ResponseStatus &response_status
   case ResponseStatus::FAILURE_INVALID_TASK:
     os << "FAILURE_INVALID_TASK"; //
     break;
+  case ResponseStatus::CANCELLED:
+    os << "CANCELLED"; //
+    break;
+  case ResponseStatus::EXPIRED:
+    os << "EXPIRED"; //
+    break;
+  case ResponseStatus::SKIPPED:
+    os << "SKIPPED"; //
+    break;
   default:
     os << "UNKNOWN_RESPONSE_STATUS (value: "
        << static_cast<int>(response_status) << ")"; //
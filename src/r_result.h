@@ -1,8 +1,14 @@
 #pragma once
 
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
 #include <optional>
 #include <ostream>
 #include <string>
+#include <string_view>
+#include <utility>
 #include <variant>
 #include <vector>
 
@@ -24,21 +30,89 @@ enum class ResponseStatus {
   // not used for now
   FAILURE_TIMEOUT,
   // parsing error? probably unused, going to get caught by R_SCRIPT_ERROR
-  FAILURE_INVALID_TASK
+  FAILURE_INVALID_TASK,
+  // stopped by CancelEvalOperation, carries the output up to that point
+  CANCELLED,
+  // never run, the client stopped waiting for it while it was queued
+  EXPIRED,
+  // a snippet of a batch that never ran, an earlier one failed. only in
+  // SnippetResult, never the status of a response
+  SKIPPED
 };
 
 std::ostream &operator<<(std::ostream &os, const ResponseStatus &response_status);
 
 
+// encoding of a rendered plot
+enum class PlotFormat : uint8_t { SVG, PNG };
+
+// the format(s) an evaluation renders its plots in, chosen per request
+enum class PlotFormatPolicy : uint8_t {
+  // SVG, reported in EvalResult.svg_plots like before there were formats
+  DEFAULT,
+  SVG,
+  PNG,
+  // SVG, unless the plot is too big for it (see render_plot() in
+  // r_eval.cpp), then PNG
+  AUTO,
+};
+
+// how much console output a task may keep, per task. what doesn't fit is
+// dropped from the middle, see ConsoleOutputBuffer (r_console_output.h)
+struct OutputLimits {
+  // interpreter lines, a print() or cat() is one line however many newlines
+  // it has
+  std::size_t max_lines = 10000;
+  std::size_t max_bytes = 4 * 1024 * 1024;
+};
+
+// console output as produced vs. as kept in the response
+struct ConsoleOutputSizes {
+  std::size_t total_lines = 0;
+  std::size_t total_bytes = 0;
+  std::size_t retained_lines = 0;
+  // the truncation markers count as retained
+  std::size_t retained_bytes = 0;
+  bool truncated = false;
+};
+
+struct PlotOutput {
+  PlotFormat format = PlotFormat::SVG;
+  // the SVG text or the PNG bytes
+  std::string data;
+};
+
+// one snippet of a batch (EXECUTE_R_CODE_BATCH). its output is the ranges
+// [first_line, first_line + num_lines) of the batch's console_output and
+// [first_plot, first_plot + num_plots) of its graphic_output
+struct SnippetResult {
+  ResponseStatus status = ResponseStatus::SKIPPED;
+  uint64_t first_line = 0;
+  uint64_t num_lines = 0;
+  uint64_t first_plot = 0;
+  uint64_t num_plots = 0;
+  ConsoleOutputSizes console_sizes;
+  // zero if it never ran
+  std::chrono::microseconds run_time{0};
+};
+
 // result data containers
 struct RClientOutputPayload {
   // all of these should be in their output order based on the R code
   // captured text and source output from evaluate obj parsing
   std::vector<std::string> console_output;
-  // captured SVG (for now) output of plots
+  // rendered plots, in output order
   // TODO: think about compression for these, brotli prob or zstd (faster)
   //       or let the network thread compress. premature opt
-  std::vector<std::string> graphic_output;
+  std::vector<PlotOutput> graphic_output;
+  // the policy of the task, decides how the plots are reported
+  PlotFormatPolicy plot_policy = PlotFormatPolicy::DEFAULT;
+  // console_output is only the head and tail of the output if it went over
+  // the task's OutputLimits
+  ConsoleOutputSizes console_sizes;
+  // batches only, one per snippet in order. the output above is theirs put
+  // together, console_sizes their sums
+  std::vector<SnippetResult> snippets;
 };
 
 // payload for cpp management tasks
@@ -50,6 +124,50 @@ struct ManagementTaskResultPayload {
   std::string result_message;
 };
 
+// a plot rendered by a render helper process (see r_plot_render.h)
+struct PlotRenderResult {
+  // false if R failed to render it
+  bool ok = false;
+  PlotFormat format = PlotFormat::SVG;
+  // the plot, or the error message if !ok
+  std::string content;
+};
+
+enum class TaskType {
+  EXECUTE_R_CODE_CLIENT,
+  EXECUTE_R_CODE_MANAGEMENT,
+  CPP_MANAGEMENT_TASK,
+  // a data frame of client_env streamed as Arrow IPC (GetTable)
+  VIEW_TABLE,
+  // client code snippets run back to back as one task (EvalRScriptBatch)
+  EXECUTE_R_CODE_BATCH
+};
+
+// scheduling class of a task, in priority order. a worker runs queued tasks
+// of a higher class first (see r_task_scheduler.h). tasks get one from their
+// TaskType unless the request asks for another
+enum class TaskClass : uint8_t {
+  // C++ commands, monitoring probes
+  CONTROL,
+  // management R code and table views, someone is looking at a UI
+  INTERACTIVE,
+  // client code, e.g. an agent's snippets
+  CLIENT,
+};
+constexpr std::size_t num_task_classes = 3;
+
+// where a task's time went, filled in by the worker
+struct TaskTiming {
+  // what the task was queued as, its queue wait is counted per class
+  TaskClass task_class = TaskClass::CLIENT;
+  // from the task's creation in the front-end to the worker picking it up
+  std::chrono::microseconds queue_wait{0};
+  // zero for tasks that never ran
+  std::chrono::microseconds run_time{0};
+  // ran, but the client's deadline had passed by the time it was done
+  bool finished_past_deadline = false;
+};
+
 // variant for these two and the possibility of neither (for the error types)
 using ResultData = std::variant<std::monostate, RClientOutputPayload,
                                 ManagementTaskResultPayload>;
@@ -73,8 +191,25 @@ public:
   }
   const ResultData &get_result_payload() const { return result_payload_; }
 
+  // move the payload/error out instead of copying, for the consumer at the
+  // end of the line. the response is left with an empty payload/error
+  ResultData take_result_payload() {
+    return std::exchange(result_payload_, std::monostate{});
+  }
+  std::optional<std::string> take_error_message() {
+    return std::exchange(error_message_, std::nullopt);
+  }
+
   bool is_success() const { return status_ == ResponseStatus::SUCCESS; }
 
+  const TaskTiming &get_timing() const { return timing_; }
+  void set_timing(TaskTiming timing) { timing_ = timing; }
+
+  // of the task answered, only EXECUTE_R_CODE_CLIENT and
+  // EXECUTE_R_CODE_BATCH tasks have an operation in the front-end's store
+  TaskType get_task_type() const { return task_type_; }
+  void set_task_type(TaskType task_type) { task_type_ = task_type; }
+
   // could add future convenience getters based on the variant type of
   // ResultData
 
@@ -83,9 +218,60 @@ private:
   ResponseStatus status_;
   std::optional<std::string> error_message_;
   ResultData result_payload_;
+  TaskTiming timing_;
+  TaskType task_type_ = TaskType::EXECUTE_R_CODE_CLIENT;
 };
 
 // debug print overload
 std::ostream &operator<<(std::ostream &os, const RResponse &response);
 
+// incremental output for streaming clients, pushed while a task is still
+// running. the full RResponse is still built and sent at the end, these are
+// just an early copy of the same output
+enum class OutputEventType {
+  SOURCE,
+  TEXT,
+  MESSAGE,
+  WARNING,
+  ERROR,
+  PLOT,
+  // last event for a task, carries the final status
+  DONE,
+  // a piece of a VIEW_TABLE task's Arrow IPC stream, in order
+  TABLE_DATA
+};
+
+struct OutputEvent {
+  OutputEventType type;
+  // one line of text, or the plot's data for PLOT, the bytes for TABLE_DATA,
+  // empty for DONE (or the error message if the task failed)
+  std::string content;
+  // only meaningful for DONE
+  ResponseStatus status = ResponseStatus::SUCCESS;
+  // only meaningful for PLOT
+  PlotFormat plot_format = PlotFormat::SVG;
+};
+
+// receiver for OutputEvents, attached to an RTask by whoever wants the
+// output as it is produced. push_event is called from the R worker thread
+// so implementations need to be thread safe and should not block for long
+class OutputEventSink {
+public:
+  virtual ~OutputEventSink() = default;
+  virtual void push_event(OutputEvent event) = 0;
+
+  // an event whose content is the concatenation of pieces, for big data
+  // (TABLE_DATA) that still sits in other buffers. the pieces only have to
+  // live until the call returns. copies them together by default, sinks that
+  // can write them out as they are override it
+  virtual void push_data_event(OutputEventType type,
+                               const std::vector<std::string_view> &pieces) {
+    OutputEvent event{type, ""};
+    for (std::string_view piece : pieces) {
+      event.content.append(piece);
+    }
+    push_event(std::move(event));
+  }
+};
+
 } // namespace RWorker
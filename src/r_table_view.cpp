@@ -0,0 +1,1171 @@
+#include "r_table_view.h"
+#include "arrow_ipc.h"
+
+#include <R/Rinternals.h>
+#include <cpp11.hpp>
+
+#include <absl/container/flat_hash_map.h>
+#include <absl/container/node_hash_map.h>
+
+#include <algorithm>
+#include <charconv>
+#include <chrono>
+#include <climits>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <deque>
+#include <memory>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace RWorker {
+
+namespace {
+
+// a record batch goes out as one OUTPUT_EVENT frame, this stays well below
+// the frame limit. a batch of long strings that gets bigger has to be asked
+// for with fewer batch_rows
+constexpr std::size_t max_batch_message_bytes = 256 * 1024 * 1024;
+
+// how long the R thread waits for the client to read, over the whole stream.
+// it is per stream and not per wait, so a client that reads a little every
+// so often can't hold the worker for longer than this either
+constexpr std::chrono::seconds table_client_wait_budget(60);
+
+// what the client did wrong, as opposed to an R error
+class TableViewError : public std::runtime_error {
+public:
+  using std::runtime_error::runtime_error;
+};
+
+// the stream ended before all of it was sent, status says why
+class TableStreamStopped : public std::runtime_error {
+public:
+  TableStreamStopped(ResponseStatus status, const std::string &message)
+      : std::runtime_error(message), status(status) {}
+
+  ResponseStatus status;
+};
+
+// how a column is sent, and compared by filters
+ArrowColumnType column_type(SEXP values, bool &converted) {
+  converted = false;
+  bool has_class = Rf_getAttrib(values, R_ClassSymbol) != R_NilValue;
+  if (Rf_inherits(values, "factor") && TYPEOF(values) == INTSXP) {
+    return ArrowColumnType::DICTIONARY_UTF8;
+  }
+  if (Rf_inherits(values, "Date") &&
+      (TYPEOF(values) == INTSXP || TYPEOF(values) == REALSXP)) {
+    return ArrowColumnType::DATE32;
+  }
+  if (!has_class) {
+    switch (TYPEOF(values)) {
+    case REALSXP:
+      return ArrowColumnType::FLOAT64;
+    case INTSXP:
+      return ArrowColumnType::INT32;
+    case LGLSXP:
+      return ArrowColumnType::BOOL;
+    case STRSXP:
+      return ArrowColumnType::UTF8;
+    default:
+      break;
+    }
+  }
+  // POSIXct, list columns, complex, ...: as R prints them
+  converted = true;
+  return ArrowColumnType::UTF8;
+}
+
+std::string utf8_string(SEXP charsxp) {
+  if (Rf_charIsUTF8(charsxp)) {
+    return std::string(CHAR(charsxp), LENGTH(charsxp));
+  }
+  return cpp11::safe[Rf_translateCharUTF8](charsxp);
+}
+
+// ---- sorted and filtered views
+//
+// a view is the rows of a data frame that pass the request's filters, in the
+// order of its sort keys. sort orders (R's radix order()), filter results
+// (one bit per row) and the last view built are cached per variable, so
+// scrolling only costs the page and changing one filter or sort key only
+// redoes that one. an index is only reused while the columns it was built
+// from are the same. right after R code ran that is checked against a
+// fingerprint of the columns (data.table changes columns in place, the
+// pointers alone don't say enough), otherwise nothing can have changed
+
+// rows of the data frame in view order, 0-based
+using RowOrder = std::vector<int32_t>;
+// bit i set if row i passes
+using RowBitmap = std::vector<uint64_t>;
+
+// most the cached indexes of a worker may take, least recently used data
+// frames go first. a 10M row data frame takes 40 MB per sort order or view
+// and 1.25 MB per filter
+constexpr std::size_t table_index_cache_bytes = 512 * 1024 * 1024;
+
+// bumped every time R code runs, see mark_table_views_stale()
+uint64_t r_code_generation = 0;
+
+// mixes bytes 8 at a time, four lanes so it isn't one long dependency chain.
+// only has to notice changes, not resist anyone
+uint64_t hash_bytes(const void *data, std::size_t size, uint64_t seed) {
+  constexpr uint64_t multiplier = 0x9E3779B97F4A7C15ULL;
+  const char *bytes = static_cast<const char *>(data);
+  uint64_t lanes[4] = {seed, seed + 1, seed + 2, seed + 3};
+  std::size_t i = 0;
+  for (; i + 32 <= size; i += 32) {
+    for (int lane = 0; lane < 4; ++lane) {
+      uint64_t word;
+      std::memcpy(&word, bytes + i + lane * 8, sizeof(word));
+      lanes[lane] = (lanes[lane] ^ word) * multiplier;
+      lanes[lane] ^= lanes[lane] >> 29;
+    }
+  }
+  uint64_t hash = lanes[0] ^ (lanes[1] << 1) ^ (lanes[2] << 2) ^ (lanes[3] << 3);
+  for (; i < size; ++i) {
+    hash = (hash ^ static_cast<unsigned char>(bytes[i])) * multiplier;
+  }
+  return hash ^ (hash >> 31);
+}
+
+// of everything a sort order or filter result depends on. R keeps a single
+// CHARSXP per distinct string, so hashing the pointers of a character vector
+// covers its strings
+uint64_t column_hash(SEXP column) {
+  uint64_t hash = static_cast<uint64_t>(XLENGTH(column)) ^
+                  (static_cast<uint64_t>(TYPEOF(column)) << 56);
+  std::size_t length = static_cast<std::size_t>(XLENGTH(column));
+  switch (TYPEOF(column)) {
+  case REALSXP:
+    hash = hash_bytes(REAL(column), length * sizeof(double), hash);
+    break;
+  case INTSXP:
+    hash = hash_bytes(INTEGER(column), length * sizeof(int), hash);
+    break;
+  case LGLSXP:
+    hash = hash_bytes(LOGICAL(column), length * sizeof(int), hash);
+    break;
+  case CPLXSXP:
+    hash = hash_bytes(COMPLEX(column), length * sizeof(Rcomplex), hash);
+    break;
+  case RAWSXP:
+    hash = hash_bytes(RAW(column), length, hash);
+    break;
+  case STRSXP:
+    hash = hash_bytes(STRING_PTR_RO(column), length * sizeof(SEXP), hash);
+    break;
+  case VECSXP:
+    // only the elements' identity
+    for (std::size_t i = 0; i < length; ++i) {
+      SEXP element = VECTOR_ELT(column, static_cast<R_xlen_t>(i));
+      hash = hash_bytes(&element, sizeof(element), hash);
+    }
+    break;
+  default:
+    break;
+  }
+  // factor levels, a Date that became something else
+  for (SEXP attribute : {R_LevelsSymbol, R_ClassSymbol}) {
+    SEXP value = Rf_getAttrib(column, attribute);
+    if (TYPEOF(value) == STRSXP) {
+      hash = hash_bytes(STRING_PTR_RO(value), XLENGTH(value) * sizeof(SEXP),
+                        hash);
+    }
+  }
+  return hash;
+}
+
+// a column some cached index was built from
+struct ColumnFingerprint {
+  SEXP column = nullptr;
+  uint64_t hash = 0;
+};
+
+// the cached indexes of one variable
+struct FrameIndexes {
+  // identity only, not protected. while no R code ran the variable can't
+  // have been rebound, after that the fingerprints decide
+  SEXP frame = nullptr;
+  R_xlen_t rows = 0;
+  uint64_t checked_generation = 0;
+  uint64_t last_used = 0;
+  absl::flat_hash_map<std::string, ColumnFingerprint> columns;
+  // keyed by sort_key()/filter_key()/view_key()
+  absl::flat_hash_map<std::string, std::shared_ptr<const RowOrder>> sorts;
+  absl::flat_hash_map<std::string, std::shared_ptr<const RowBitmap>> filters;
+  std::string view_key;
+  std::shared_ptr<const RowOrder> view;
+
+  std::size_t bytes() const {
+    std::size_t total = 0;
+    for (const auto &[key, order] : sorts) {
+      total += order->size() * sizeof(int32_t);
+    }
+    for (const auto &[key, bitmap] : filters) {
+      total += bitmap->size() * sizeof(uint64_t);
+    }
+    // a view without filters is its sort order, counted already
+    if (view != nullptr &&
+        std::none_of(sorts.begin(), sorts.end(), [this](const auto &sort) {
+          return sort.second == view;
+        })) {
+      total += view->size() * sizeof(int32_t);
+    }
+    return total;
+  }
+};
+
+class TableIndexCache {
+public:
+  // the indexes of variable, emptied first if the data frame isn't the one
+  // they were built from anymore
+  FrameIndexes &indexes_for(const std::string &variable, SEXP frame,
+                            R_xlen_t rows, SEXP names) {
+    FrameIndexes &indexes = frames_[variable];
+    indexes.last_used = ++use_counter_;
+    if (indexes.frame != frame || indexes.rows != rows ||
+        (indexes.checked_generation != r_code_generation &&
+         !columns_unchanged(indexes, frame, names))) {
+      indexes = FrameIndexes{};
+      indexes.frame = frame;
+      indexes.rows = rows;
+      indexes.last_used = use_counter_;
+    }
+    indexes.checked_generation = r_code_generation;
+    return indexes;
+  }
+
+  // drops the least recently used data frames' indexes while over budget.
+  // if the one in use alone is still over, it keeps just its view
+  void trim(FrameIndexes &in_use) {
+    std::size_t total = 0;
+    for (const auto &[variable, indexes] : frames_) {
+      total += indexes.bytes();
+    }
+    while (total > table_index_cache_bytes && frames_.size() > 1) {
+      auto oldest = frames_.end();
+      for (auto it = frames_.begin(); it != frames_.end(); ++it) {
+        if (&it->second != &in_use &&
+            (oldest == frames_.end() ||
+             it->second.last_used < oldest->second.last_used)) {
+          oldest = it;
+        }
+      }
+      total -= oldest->second.bytes();
+      frames_.erase(oldest);
+    }
+    if (total > table_index_cache_bytes) {
+      in_use.sorts.clear();
+      in_use.filters.clear();
+    }
+  }
+
+private:
+  static bool columns_unchanged(const FrameIndexes &indexes, SEXP frame,
+                                SEXP names);
+
+  // node map, indexes_for() hands out references
+  absl::node_hash_map<std::string, FrameIndexes> frames_;
+  uint64_t use_counter_ = 0;
+};
+
+TableIndexCache &table_index_cache() {
+  // never destroyed, like the R objects it refers to
+  static TableIndexCache *cache = new TableIndexCache();
+  return *cache;
+}
+
+// the column called name, R_NilValue if there is none
+SEXP find_column(SEXP frame, SEXP names, const std::string &name) {
+  if (TYPEOF(names) != STRSXP) {
+    return R_NilValue;
+  }
+  for (R_xlen_t i = 0; i < XLENGTH(names) && i < XLENGTH(frame); ++i) {
+    SEXP charsxp = STRING_ELT(names, i);
+    if (charsxp != NA_STRING && utf8_string(charsxp) == name) {
+      return VECTOR_ELT(frame, i);
+    }
+  }
+  return R_NilValue;
+}
+
+SEXP column_or_throw(SEXP frame, SEXP names, const std::string &name) {
+  SEXP column = find_column(frame, names, name);
+  if (column == R_NilValue) {
+    throw TableViewError("No column '" + name + "'");
+  }
+  return column;
+}
+
+bool TableIndexCache::columns_unchanged(const FrameIndexes &indexes,
+                                        SEXP frame, SEXP names) {
+  for (const auto &[name, fingerprint] : indexes.columns) {
+    SEXP column = find_column(frame, names, name);
+    if (column != fingerprint.column || column_hash(column) != fingerprint.hash) {
+      return false;
+    }
+  }
+  return true;
+}
+
+// records what an index built from column depends on
+void track_column(FrameIndexes &indexes, const std::string &name,
+                  SEXP column) {
+  if (!indexes.columns.contains(name)) {
+    indexes.columns[name] = ColumnFingerprint{column, column_hash(column)};
+  }
+}
+
+// length-prefixed so no two different requests end up with the same key
+void append_key_part(std::string &key, std::string_view part) {
+  key += std::to_string(part.size());
+  key += ':';
+  key += part;
+}
+
+std::string sort_key(const std::vector<TableSortKey> &sort) {
+  std::string key;
+  for (const TableSortKey &sort_key : sort) {
+    append_key_part(key, sort_key.column);
+    key += sort_key.descending ? '-' : '+';
+  }
+  return key;
+}
+
+std::string filter_key(const TableFilter &filter) {
+  std::string key;
+  key += static_cast<char>('a' + static_cast<int>(filter.op));
+  append_key_part(key, filter.column);
+  append_key_part(key, filter.value);
+  return key;
+}
+
+std::string view_key(const TableViewPayload &payload) {
+  std::string key = sort_key(payload.sort);
+  key += '|';
+  for (const TableFilter &filter : payload.filters) {
+    key += filter_key(filter);
+  }
+  return key;
+}
+
+std::shared_ptr<const RowOrder> sort_order(FrameIndexes &indexes, SEXP frame,
+                                           SEXP names,
+                                           const std::vector<TableSortKey> &sort) {
+  std::string key = sort_key(sort);
+  auto cached = indexes.sorts.find(key);
+  if (cached != indexes.sorts.end()) {
+    return cached->second;
+  }
+
+  cpp11::writable::list columns(static_cast<R_xlen_t>(sort.size()));
+  cpp11::writable::logicals decreasing(static_cast<R_xlen_t>(sort.size()));
+  for (std::size_t i = 0; i < sort.size(); ++i) {
+    SEXP column = column_or_throw(frame, names, sort[i].column);
+    track_column(indexes, sort[i].column, column);
+    columns[static_cast<R_xlen_t>(i)] = column;
+    decreasing[static_cast<R_xlen_t>(i)] = cpp11::r_bool(sort[i].descending);
+  }
+
+  // .harness_table_order, defined by RSetup
+  cpp11::function table_order(cpp11::safe[Rf_findVarInFrame](
+      R_GlobalEnv, Rf_install(".harness_table_order")));
+  cpp11::sexp r_order = table_order(columns, decreasing);
+
+  auto order = std::make_shared<RowOrder>();
+  order->reserve(static_cast<std::size_t>(indexes.rows));
+  if (TYPEOF(r_order) == INTSXP) {
+    const int *rows = INTEGER(r_order);
+    for (R_xlen_t i = 0; i < XLENGTH(r_order); ++i) {
+      order->push_back(rows[i] - 1);
+    }
+  } else if (TYPEOF(r_order) == REALSXP) {
+    const double *rows = REAL(r_order);
+    for (R_xlen_t i = 0; i < XLENGTH(r_order); ++i) {
+      order->push_back(static_cast<int32_t>(rows[i]) - 1);
+    }
+  }
+  if (static_cast<R_xlen_t>(order->size()) != indexes.rows) {
+    throw std::runtime_error("order() didn't return one index per row");
+  }
+  indexes.sorts[key] = order;
+  return order;
+}
+
+// "YYYY-MM-DD" as days since the epoch
+std::optional<double> parse_date(std::string_view text) {
+  int year = 0;
+  unsigned month = 0;
+  unsigned day = 0;
+  const char *end = text.data() + text.size();
+  auto [after_year, year_error] = std::from_chars(text.data(), end, year);
+  if (year_error != std::errc() || after_year == end || *after_year != '-') {
+    return std::nullopt;
+  }
+  auto [after_month, month_error] =
+      std::from_chars(after_year + 1, end, month);
+  if (month_error != std::errc() || after_month == end ||
+      *after_month != '-') {
+    return std::nullopt;
+  }
+  auto [after_day, day_error] = std::from_chars(after_month + 1, end, day);
+  if (day_error != std::errc() || after_day != end) {
+    return std::nullopt;
+  }
+  std::chrono::year_month_day date{std::chrono::year(year),
+                                   std::chrono::month(month),
+                                   std::chrono::day(day)};
+  if (!date.ok()) {
+    return std::nullopt;
+  }
+  return static_cast<double>(
+      std::chrono::sys_days(date).time_since_epoch().count());
+}
+
+std::optional<double> parse_number(std::string_view text) {
+  double value = 0;
+  auto [end, error] =
+      std::from_chars(text.data(), text.data() + text.size(), value);
+  if (error != std::errc() || end != text.data() + text.size()) {
+    return std::nullopt;
+  }
+  return value;
+}
+
+std::optional<double> parse_logical(std::string_view text) {
+  if (text == "TRUE" || text == "true" || text == "T" || text == "1") {
+    return 1.0;
+  }
+  if (text == "FALSE" || text == "false" || text == "F" || text == "0") {
+    return 0.0;
+  }
+  return std::nullopt;
+}
+
+template <typename T> bool compare(TableFilterOp op, const T &a, const T &b) {
+  switch (op) {
+  case TableFilterOp::EQUAL:
+    return a == b;
+  case TableFilterOp::NOT_EQUAL:
+    return a != b;
+  case TableFilterOp::LESS:
+    return a < b;
+  case TableFilterOp::LESS_EQUAL:
+    return a <= b;
+  case TableFilterOp::GREATER:
+    return a > b;
+  case TableFilterOp::GREATER_EQUAL:
+    return a >= b;
+  default:
+    return false;
+  }
+}
+
+template <typename Passes>
+std::shared_ptr<RowBitmap> bitmap_of(R_xlen_t rows, Passes passes) {
+  auto bitmap = std::make_shared<RowBitmap>((rows + 63) / 64, 0);
+  for (R_xlen_t i = 0; i < rows; ++i) {
+    if (passes(i)) {
+      (*bitmap)[i / 64] |= uint64_t{1} << (i % 64);
+    }
+  }
+  return bitmap;
+}
+
+// filter on text, or on what R prints for columns that aren't sent as one
+// of the other types. op on each string, NA only passes IS_NA
+std::shared_ptr<RowBitmap> text_filter(SEXP strings,
+                                       const TableFilter &filter) {
+  bool na_passes = filter.op == TableFilterOp::IS_NA;
+  bool value_passes = filter.op == TableFilterOp::NOT_NA;
+  std::string_view value = filter.value;
+  return bitmap_of(XLENGTH(strings), [&](R_xlen_t i) {
+    SEXP charsxp = STRING_ELT(strings, i);
+    if (charsxp == NA_STRING) {
+      return na_passes;
+    }
+    if (filter.op == TableFilterOp::IS_NA ||
+        filter.op == TableFilterOp::NOT_NA) {
+      return value_passes;
+    }
+    std::string translated;
+    std::string_view text;
+    if (Rf_charIsUTF8(charsxp)) {
+      text = std::string_view(CHAR(charsxp), LENGTH(charsxp));
+    } else {
+      translated = utf8_string(charsxp);
+      text = translated;
+    }
+    if (filter.op == TableFilterOp::CONTAINS) {
+      return text.find(value) != std::string_view::npos;
+    }
+    return compare(filter.op, text, value);
+  });
+}
+
+std::shared_ptr<RowBitmap> factor_filter(SEXP codes,
+                                         const TableFilter &filter) {
+  SEXP levels = Rf_getAttrib(codes, R_LevelsSymbol);
+  R_xlen_t num_levels = TYPEOF(levels) == STRSXP ? XLENGTH(levels) : 0;
+  std::vector<std::string> labels;
+  labels.reserve(num_levels);
+  for (R_xlen_t i = 0; i < num_levels; ++i) {
+    labels.push_back(utf8_string(STRING_ELT(levels, i)));
+  }
+
+  // decided once per level, the rows only look it up
+  std::vector<char> level_passes(num_levels, 0);
+  bool is_na_test = filter.op == TableFilterOp::IS_NA ||
+                    filter.op == TableFilterOp::NOT_NA;
+  bool ordering = filter.op != TableFilterOp::EQUAL &&
+                  filter.op != TableFilterOp::NOT_EQUAL &&
+                  filter.op != TableFilterOp::CONTAINS && !is_na_test;
+  // ordering compares level positions, like an ordered factor does
+  R_xlen_t position = 0;
+  if (ordering) {
+    auto it = std::find(labels.begin(), labels.end(), filter.value);
+    if (it == labels.end()) {
+      throw TableViewError("'" + filter.value + "' is not a level of '" +
+                           filter.column + "'");
+    }
+    position = it - labels.begin();
+  }
+  for (R_xlen_t i = 0; i < num_levels; ++i) {
+    if (is_na_test) {
+      level_passes[i] = filter.op == TableFilterOp::NOT_NA;
+    } else if (filter.op == TableFilterOp::CONTAINS) {
+      level_passes[i] = labels[i].find(filter.value) != std::string::npos;
+    } else if (ordering) {
+      level_passes[i] = compare(filter.op, i, position);
+    } else {
+      level_passes[i] = compare(filter.op, labels[i], filter.value);
+    }
+  }
+
+  const int *values = INTEGER(codes);
+  bool na_passes = filter.op == TableFilterOp::IS_NA;
+  return bitmap_of(XLENGTH(codes), [&](R_xlen_t i) {
+    int code = values[i];
+    if (code == NA_INTEGER || code < 1 || code > num_levels) {
+      return na_passes;
+    }
+    return level_passes[code - 1] != 0;
+  });
+}
+
+// numbers, logicals (0/1) and Dates (days)
+std::shared_ptr<RowBitmap> numeric_filter(SEXP column, ArrowColumnType type,
+                                          const TableFilter &filter) {
+  bool is_na_test = filter.op == TableFilterOp::IS_NA ||
+                    filter.op == TableFilterOp::NOT_NA;
+  if (filter.op == TableFilterOp::CONTAINS) {
+    throw TableViewError("CONTAINS needs a text or factor column, '" +
+                         filter.column + "' isn't one");
+  }
+  double value = 0;
+  if (!is_na_test) {
+    std::optional<double> parsed =
+        type == ArrowColumnType::DATE32   ? parse_date(filter.value)
+        : type == ArrowColumnType::BOOL ? parse_logical(filter.value)
+                                        : parse_number(filter.value);
+    if (!parsed.has_value()) {
+      throw TableViewError("Can't compare column '" + filter.column +
+                           "' with '" + filter.value + "'");
+    }
+    value = *parsed;
+  }
+
+  auto passes = [&](bool na, double x) {
+    if (is_na_test) {
+      return na == (filter.op == TableFilterOp::IS_NA);
+    }
+    return !na && compare(filter.op, x, value);
+  };
+  if (TYPEOF(column) == REALSXP) {
+    const double *values = REAL(column);
+    bool date = type == ArrowColumnType::DATE32;
+    return bitmap_of(XLENGTH(column), [&](R_xlen_t i) {
+      // fractional days are still that day
+      double x = date ? std::floor(values[i]) : values[i];
+      return passes(ISNAN(values[i]), x);
+    });
+  }
+  const int *values =
+      TYPEOF(column) == LGLSXP ? LOGICAL(column) : INTEGER(column);
+  return bitmap_of(XLENGTH(column), [&](R_xlen_t i) {
+    return passes(values[i] == NA_INTEGER, static_cast<double>(values[i]));
+  });
+}
+
+std::shared_ptr<const RowBitmap> filter_rows(FrameIndexes &indexes,
+                                             SEXP frame, SEXP names,
+                                             const TableFilter &filter) {
+  std::string key = filter_key(filter);
+  auto cached = indexes.filters.find(key);
+  if (cached != indexes.filters.end()) {
+    return cached->second;
+  }
+
+  SEXP column = column_or_throw(frame, names, filter.column);
+  track_column(indexes, filter.column, column);
+
+  std::shared_ptr<RowBitmap> bitmap;
+  bool converted = false;
+  ArrowColumnType type = column_type(column, converted);
+  if (converted) {
+    cpp11::sexp text =
+        cpp11::package("base")["as.character"](column);
+    if (TYPEOF(text) != STRSXP || XLENGTH(text) != indexes.rows) {
+      throw TableViewError("Column '" + filter.column +
+                           "' can't be converted to text");
+    }
+    bitmap = text_filter(text, filter);
+  } else if (type == ArrowColumnType::UTF8) {
+    bitmap = text_filter(column, filter);
+  } else if (type == ArrowColumnType::DICTIONARY_UTF8) {
+    bitmap = factor_filter(column, filter);
+  } else {
+    bitmap = numeric_filter(column, type, filter);
+  }
+  indexes.filters[key] = bitmap;
+  return bitmap;
+}
+
+// the rows of the request's view, cached as the frame's last view
+std::shared_ptr<const RowOrder> view_rows(FrameIndexes &indexes, SEXP frame,
+                                          SEXP names,
+                                          const TableViewPayload &payload) {
+  std::string key = view_key(payload);
+  if (indexes.view != nullptr && indexes.view_key == key) {
+    return indexes.view;
+  }
+
+  std::shared_ptr<const RowOrder> order;
+  if (!payload.sort.empty()) {
+    order = sort_order(indexes, frame, names, payload.sort);
+  }
+
+  std::shared_ptr<const RowOrder> view;
+  if (payload.filters.empty()) {
+    view = order;
+  } else {
+    RowBitmap passing;
+    for (const TableFilter &filter : payload.filters) {
+      std::shared_ptr<const RowBitmap> bitmap =
+          filter_rows(indexes, frame, names, filter);
+      if (passing.empty()) {
+        passing = *bitmap;
+      } else {
+        for (std::size_t i = 0; i < passing.size(); ++i) {
+          passing[i] &= (*bitmap)[i];
+        }
+      }
+    }
+    auto passes = [&](int32_t row) {
+      return (passing[row / 64] >> (row % 64)) & 1;
+    };
+
+    auto rows = std::make_shared<RowOrder>();
+    if (order != nullptr) {
+      for (int32_t row : *order) {
+        if (passes(row)) {
+          rows->push_back(row);
+        }
+      }
+    } else {
+      for (int32_t row = 0; row < indexes.rows; ++row) {
+        if (passes(row)) {
+          rows->push_back(row);
+        }
+      }
+    }
+    rows->shrink_to_fit();
+    view = std::move(rows);
+  }
+
+  indexes.view_key = std::move(key);
+  indexes.view = view;
+  return view;
+}
+
+// ---- encoding
+
+// one column of the data frame, as it goes into the stream
+struct ColumnSource {
+  ArrowColumnType type = ArrowColumnType::UTF8;
+  // the R vector the values are read from
+  cpp11::sexp values;
+  // as.character() fallback, values only has the page's rows
+  bool page_only = false;
+  // DICTIONARY_UTF8, the factor's levels
+  cpp11::sexp levels;
+};
+
+// the rows of a record batch, as indexes into a column's vector: either
+// first on, or the listed ones (rows of a view)
+struct BatchRows {
+  R_xlen_t first = 0;
+  const int32_t *rows = nullptr;
+  R_xlen_t length = 0;
+
+  R_xlen_t at(R_xlen_t i) const {
+    return rows != nullptr ? rows[i] : first + i;
+  }
+  bool contiguous() const { return rows == nullptr; }
+};
+
+// the bytes of n elements of R's memory, not copied
+template <typename T> std::string_view r_memory(const T *data, R_xlen_t n) {
+  return std::string_view(reinterpret_cast<const char *>(data),
+                          static_cast<std::size_t>(n) * sizeof(T));
+}
+
+// length values of type T, value(i) each
+template <typename T, typename Value>
+std::string gather(R_xlen_t length, Value value) {
+  std::string out(static_cast<std::size_t>(length) * sizeof(T), '\0');
+  for (R_xlen_t i = 0; i < length; ++i) {
+    T element = value(i);
+    std::memcpy(out.data() + i * sizeof(T), &element, sizeof(T));
+  }
+  return out;
+}
+
+// the owner outlives the views handed out, deque so they never move
+std::string_view keep(std::deque<std::string> &owned, std::string buffer) {
+  return owned.emplace_back(std::move(buffer));
+}
+
+// validity bitmap of length values, empty (and null_count 0) if none is null
+template <typename IsNull>
+std::string validity_bitmap(R_xlen_t length, IsNull is_null,
+                            int64_t &null_count) {
+  std::string bitmap(arrow_bitmap_bytes(length), '\0');
+  null_count = 0;
+  for (R_xlen_t i = 0; i < length; ++i) {
+    if (is_null(i)) {
+      ++null_count;
+    } else {
+      bitmap[i / 8] |= static_cast<char>(1 << (i % 8));
+    }
+  }
+  if (null_count == 0) {
+    bitmap.clear();
+  }
+  return bitmap;
+}
+
+// the rows of strings as Arrow's int32 offsets + UTF-8 data. UTF-8 (and
+// ASCII) strings are appended as they are, others go through R
+ArrowColumn utf8_column(SEXP strings, const BatchRows &rows,
+                        std::deque<std::string> &owned) {
+  ArrowColumn column;
+  column.length = rows.length;
+  column.validity = keep(
+      owned, validity_bitmap(
+                 rows.length,
+                 [&](R_xlen_t i) {
+                   return STRING_ELT(strings, rows.at(i)) == NA_STRING;
+                 },
+                 column.null_count));
+
+  std::string offsets(
+      static_cast<std::size_t>(rows.length + 1) * sizeof(int32_t), '\0');
+  std::string data;
+  for (R_xlen_t i = 0; i < rows.length; ++i) {
+    SEXP charsxp = STRING_ELT(strings, rows.at(i));
+    if (charsxp != NA_STRING) {
+      if (Rf_charIsUTF8(charsxp)) {
+        data.append(CHAR(charsxp), LENGTH(charsxp));
+      } else {
+        data.append(cpp11::safe[Rf_translateCharUTF8](charsxp));
+      }
+      if (data.size() > INT32_MAX) {
+        throw TableViewError(
+            "Strings of a record batch are over 2 GiB, ask for fewer "
+            "batch_rows");
+      }
+    }
+    int32_t end = static_cast<int32_t>(data.size());
+    std::memcpy(offsets.data() + (i + 1) * sizeof(int32_t), &end,
+                sizeof(end));
+  }
+  column.values = keep(owned, std::move(offsets));
+  column.data = keep(owned, std::move(data));
+  return column;
+}
+
+// the batch's rows of the source. a contiguous range of a double or integer
+// vector is referenced, anything else is copied into owned
+ArrowColumn batch_column(const ColumnSource &source, const BatchRows &rows,
+                         std::deque<std::string> &owned) {
+  R_xlen_t length = rows.length;
+  ArrowColumn column;
+  column.length = length;
+
+  switch (source.type) {
+  case ArrowColumnType::FLOAT64: {
+    // NA is null, NaN stays a NaN value
+    const double *values = REAL(source.values);
+    column.validity = keep(
+        owned, validity_bitmap(
+                   length,
+                   [&](R_xlen_t i) { return ISNA(values[rows.at(i)]) != 0; },
+                   column.null_count));
+    column.values =
+        rows.contiguous()
+            ? r_memory(values + rows.first, length)
+            : keep(owned, gather<double>(length, [&](R_xlen_t i) {
+                     return values[rows.at(i)];
+                   }));
+    break;
+  }
+  case ArrowColumnType::INT32:
+  case ArrowColumnType::DATE32:
+    if (TYPEOF(source.values) == INTSXP) {
+      // R's int is Arrow's int32, and Date stored as integer is already days
+      // since the epoch. NA_INTEGER is only masked by the bitmap
+      const int *values = INTEGER(source.values);
+      column.validity = keep(
+          owned, validity_bitmap(
+                     length,
+                     [&](R_xlen_t i) {
+                       return values[rows.at(i)] == NA_INTEGER;
+                     },
+                     column.null_count));
+      column.values =
+          rows.contiguous()
+              ? r_memory(values + rows.first, length)
+              : keep(owned, gather<int32_t>(length, [&](R_xlen_t i) {
+                       return values[rows.at(i)];
+                     }));
+    } else {
+      // Date stored as double, possibly fractional days
+      const double *values = REAL(source.values);
+      auto representable = [&](R_xlen_t i) {
+        double day = values[rows.at(i)];
+        return std::isfinite(day) && std::abs(day) <= INT32_MAX;
+      };
+      column.validity = keep(
+          owned, validity_bitmap(
+                     length, [&](R_xlen_t i) { return !representable(i); },
+                     column.null_count));
+      column.values = keep(owned, gather<int32_t>(length, [&](R_xlen_t i) {
+                             return representable(i)
+                                        ? static_cast<int32_t>(
+                                              std::floor(values[rows.at(i)]))
+                                        : 0;
+                           }));
+    }
+    break;
+  case ArrowColumnType::BOOL: {
+    const int *values = LOGICAL(source.values);
+    column.validity = keep(
+        owned, validity_bitmap(
+                   length,
+                   [&](R_xlen_t i) { return values[rows.at(i)] == NA_LOGICAL; },
+                   column.null_count));
+    std::string bits(arrow_bitmap_bytes(length), '\0');
+    for (R_xlen_t i = 0; i < length; ++i) {
+      int value = values[rows.at(i)];
+      if (value != NA_LOGICAL && value != 0) {
+        bits[i / 8] |= static_cast<char>(1 << (i % 8));
+      }
+    }
+    column.values = keep(owned, std::move(bits));
+    break;
+  }
+  case ArrowColumnType::DICTIONARY_UTF8: {
+    // R's codes start at 1, Arrow's indices at 0, so this one is a copy
+    const int *codes = INTEGER(source.values);
+    column.validity = keep(
+        owned, validity_bitmap(
+                   length,
+                   [&](R_xlen_t i) { return codes[rows.at(i)] == NA_INTEGER; },
+                   column.null_count));
+    column.values = keep(owned, gather<int32_t>(length, [&](R_xlen_t i) {
+                           int code = codes[rows.at(i)];
+                           return code == NA_INTEGER ? 0 : code - 1;
+                         }));
+    break;
+  }
+  case ArrowColumnType::UTF8:
+    return utf8_column(source.values, rows, owned);
+  }
+  return column;
+}
+
+// sends the stream's messages as the client reads them: every message waits
+// for credit (RTaskControl::wait_for_credit), which the front-end gives back
+// as it writes the stream to the client. throws TableStreamStopped if the
+// task is cancelled or the client is too slow
+class TableStreamWriter {
+public:
+  TableStreamWriter(OutputEventSink &event_sink, RTaskControl &task_control)
+      : event_sink_(event_sink), task_control_(task_control) {}
+
+  // one message, metadata then body, as a single TABLE_DATA event
+  void push(const ArrowIpcMessage &message) {
+    wait_for_client(message.size());
+    std::vector<std::string_view> pieces;
+    pieces.reserve(message.body.size() + 1);
+    pieces.push_back(message.metadata);
+    pieces.insert(pieces.end(), message.body.begin(), message.body.end());
+    event_sink_.push_data_event(OutputEventType::TABLE_DATA, pieces);
+  }
+
+  void push_end_of_stream() {
+    std::string_view end = arrow_ipc_end_of_stream();
+    wait_for_client(end.size());
+    event_sink_.push_data_event(OutputEventType::TABLE_DATA, {end});
+  }
+
+  // before encoding the next batch, no point in it if nobody wants it
+  void stop_if_cancelled() {
+    if (task_control_.interrupt_reason() != InterruptReason::NONE) {
+      throw TableStreamStopped(ResponseStatus::CANCELLED, "Stream cancelled");
+    }
+  }
+
+private:
+  void wait_for_client(uint64_t bytes) {
+    auto start = std::chrono::steady_clock::now();
+    bool granted = task_control_.wait_for_credit(
+        bytes, start + (table_client_wait_budget - waited_));
+    waited_ += std::chrono::steady_clock::now() - start;
+    if (granted) {
+      return;
+    }
+    stop_if_cancelled();
+    throw TableStreamStopped(
+        ResponseStatus::FAILURE_TIMEOUT,
+        "The client read the table too slowly, the worker gave up after "
+        "waiting " +
+            std::to_string(table_client_wait_budget.count()) + "s for it");
+  }
+
+  OutputEventSink &event_sink_;
+  RTaskControl &task_control_;
+  // in wait_for_client() so far
+  std::chrono::steady_clock::duration waited_{};
+};
+
+std::string column_name(SEXP names, R_xlen_t i) {
+  if (TYPEOF(names) != STRSXP || i >= XLENGTH(names) ||
+      STRING_ELT(names, i) == NA_STRING) {
+    return "V" + std::to_string(i + 1);
+  }
+  return utf8_string(STRING_ELT(names, i));
+}
+
+// looks up the data frame, throws TableViewError if it isn't one
+cpp11::sexp find_data_frame(const std::string &variable) {
+  SEXP client_env = cpp11::safe[Rf_findVarInFrame](R_GlobalEnv,
+                                                   Rf_install("client_env"));
+  if (TYPEOF(client_env) != ENVSXP) {
+    throw std::runtime_error("The session has no client_env");
+  }
+
+  cpp11::sexp frame = cpp11::safe[Rf_findVarInFrame](
+      client_env, cpp11::safe[Rf_install](variable.c_str()));
+  if (frame == R_UnboundValue) {
+    throw TableViewError("No variable '" + variable + "' in the session");
+  }
+  if (TYPEOF(frame) == PROMSXP) {
+    frame = cpp11::safe[Rf_eval](frame, client_env);
+  }
+  if (TYPEOF(frame) != VECSXP || !Rf_inherits(frame, "data.frame")) {
+    throw TableViewError("'" + variable + "' is not a data frame");
+  }
+  return frame;
+}
+
+} // namespace
+
+void mark_table_views_stale() { ++r_code_generation; }
+
+std::unique_ptr<RResponse> view_table(const TableViewPayload &payload,
+                                      std::string task_uuid,
+                                      OutputEventSink &event_sink,
+                                      RTaskControl &task_control) {
+  TableStreamWriter writer(event_sink, task_control);
+  try {
+    cpp11::sexp frame = find_data_frame(payload.variable);
+    R_xlen_t num_columns = XLENGTH(frame);
+    // the row names have the row count even without columns, Rf_getAttrib
+    // expands their compact form though, so only look there if we must
+    R_xlen_t total_rows =
+        num_columns > 0
+            ? Rf_xlength(VECTOR_ELT(frame, 0))
+            : Rf_xlength(cpp11::sexp(
+                  cpp11::safe[Rf_getAttrib](frame, R_RowNamesSymbol)));
+    cpp11::sexp names(cpp11::safe[Rf_getAttrib](frame, R_NamesSymbol));
+
+    // with sort keys or filters the page is taken from the view's rows
+    std::shared_ptr<const RowOrder> view;
+    if (!payload.sort.empty() || !payload.filters.empty()) {
+      if (total_rows > INT32_MAX) {
+        throw TableViewError(
+            "Sorting and filtering need a data frame of fewer than 2^31 rows");
+      }
+      TableIndexCache &cache = table_index_cache();
+      FrameIndexes &indexes =
+          cache.indexes_for(payload.variable, frame, total_rows, names);
+      view = view_rows(indexes, frame, names, payload);
+      cache.trim(indexes);
+    }
+    R_xlen_t view_size =
+        view != nullptr ? static_cast<R_xlen_t>(view->size()) : total_rows;
+
+    R_xlen_t first_row = static_cast<R_xlen_t>(
+        std::min<uint64_t>(payload.offset, view_size));
+    R_xlen_t end_row =
+        payload.max_rows == 0 ||
+                payload.max_rows >= static_cast<uint64_t>(view_size - first_row)
+            ? view_size
+            : first_row + static_cast<R_xlen_t>(payload.max_rows);
+    R_xlen_t page_rows = end_row - first_row;
+    R_xlen_t batch_rows =
+        payload.batch_rows == 0
+            ? TableViewPayload{}.batch_rows
+            : static_cast<R_xlen_t>(std::min<uint64_t>(payload.batch_rows,
+                                                       INT32_MAX));
+
+    // 1-based R indexes of the page's rows, only built for columns that go
+    // through as.character()
+    cpp11::sexp page_index;
+    auto page_subset_index = [&]() -> SEXP {
+      if (page_index == R_NilValue) {
+        cpp11::writable::doubles index(page_rows);
+        for (R_xlen_t i = 0; i < page_rows; ++i) {
+          R_xlen_t row = view != nullptr ? (*view)[first_row + i] : first_row + i;
+          index[i] = static_cast<double>(row + 1);
+        }
+        page_index = index;
+      }
+      return page_index;
+    };
+
+    cpp11::function base_subset = cpp11::package("base")["["];
+    cpp11::function base_as_character = cpp11::package("base")["as.character"];
+
+    std::vector<ArrowField> fields;
+    std::vector<ColumnSource> sources;
+    fields.reserve(num_columns);
+    sources.reserve(num_columns);
+    for (R_xlen_t i = 0; i < num_columns; ++i) {
+      SEXP values = VECTOR_ELT(frame, i);
+      ArrowField field;
+      field.name = column_name(names, i);
+      if (Rf_xlength(values) != total_rows) {
+        throw TableViewError("Column '" + field.name +
+                             "' is a matrix or data frame, those can't be "
+                             "sent as a table column");
+      }
+
+      ColumnSource source;
+      source.values = values;
+      field.type = column_type(values, source.page_only);
+      if (field.type == ArrowColumnType::DICTIONARY_UTF8) {
+        field.dictionary_id = static_cast<int64_t>(i);
+        field.dictionary_ordered = Rf_inherits(values, "ordered");
+        source.levels = cpp11::safe[Rf_getAttrib](values, R_LevelsSymbol);
+        if (TYPEOF(source.levels) != STRSXP) {
+          throw TableViewError("Factor column '" + field.name +
+                               "' has no levels");
+        }
+      } else if (source.page_only) {
+        // only the page of it
+        source.values =
+            base_as_character(base_subset(values, page_subset_index()));
+        if (TYPEOF(source.values) != STRSXP ||
+            XLENGTH(source.values) != page_rows) {
+          throw TableViewError("Column '" + field.name +
+                               "' can't be converted to text");
+        }
+      }
+      fields.push_back(std::move(field));
+      sources.push_back(std::move(source));
+    }
+
+    writer.push(encode_arrow_schema(
+        fields, {{"harness:total_rows", std::to_string(total_rows)},
+                 {"harness:view_rows", std::to_string(view_size)},
+                 {"harness:offset", std::to_string(first_row)}}));
+
+    // a stream has each dictionary before the first batch that uses it
+    for (std::size_t i = 0; i < fields.size(); ++i) {
+      if (fields[i].type != ArrowColumnType::DICTIONARY_UTF8) {
+        continue;
+      }
+      std::deque<std::string> owned;
+      ArrowColumn dictionary = utf8_column(
+          sources[i].levels, BatchRows{0, nullptr, XLENGTH(sources[i].levels)},
+          owned);
+      writer.push(
+          encode_arrow_dictionary_batch(fields[i].dictionary_id, dictionary));
+    }
+
+    for (R_xlen_t batch_first = 0; batch_first < page_rows;
+         batch_first += batch_rows) {
+      writer.stop_if_cancelled();
+      R_xlen_t length = std::min(batch_rows, page_rows - batch_first);
+      BatchRows rows =
+          view != nullptr
+              ? BatchRows{0, view->data() + first_row + batch_first, length}
+              : BatchRows{first_row + batch_first, nullptr, length};
+      BatchRows page_only_rows{batch_first, nullptr, length};
+
+      std::deque<std::string> owned;
+      std::vector<ArrowColumn> columns;
+      columns.reserve(sources.size());
+      for (const ColumnSource &source : sources) {
+        columns.push_back(batch_column(
+            source, source.page_only ? page_only_rows : rows, owned));
+      }
+      ArrowIpcMessage batch = encode_arrow_record_batch(length, fields, columns);
+      if (batch.size() > max_batch_message_bytes) {
+        throw TableViewError("A record batch of " + std::to_string(length) +
+                             " rows is over 256 MiB, ask for fewer "
+                             "batch_rows");
+      }
+      writer.push(batch);
+    }
+
+    writer.push_end_of_stream();
+    return std::make_unique<RResponse>(std::move(task_uuid),
+                                       ResponseStatus::SUCCESS);
+  } catch (const TableStreamStopped &e) {
+    return std::make_unique<RResponse>(std::move(task_uuid), e.status,
+                                       std::monostate{}, e.what());
+  } catch (const TableViewError &e) {
+    return std::make_unique<RResponse>(std::move(task_uuid),
+                                       ResponseStatus::FAILURE_R_VIEW_ERROR,
+                                       std::monostate{}, e.what());
+  } catch (const cpp11::unwind_exception &) {
+    std::string message = "R error while reading the data frame";
+    try {
+      cpp11::strings r_message(
+          cpp11::package("base")["geterrmessage"]());
+      if (r_message.size() > 0) {
+        message += ": " + std::string(r_message[0]);
+      }
+    } catch (...) {
+    }
+    return std::make_unique<RResponse>(std::move(task_uuid),
+                                       ResponseStatus::FAILURE_R_VIEW_ERROR,
+                                       std::monostate{}, std::move(message));
+  } catch (const std::exception &e) {
+    return std::make_unique<RResponse>(std::move(task_uuid),
+                                       ResponseStatus::FAILURE_TASK_EXECUTION,
+                                       std::monostate{}, e.what());
+  }
+}
+
+} // namespace RWorker
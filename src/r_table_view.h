@@ -0,0 +1,36 @@
+#pragma once
+
+#include "r_result.h"
+#include "r_task.h"
+#include "r_task_control.h"
+
+#include <memory>
+#include <string>
+
+namespace RWorker {
+
+// VIEW_TABLE: streams rows of the data frame payload.variable in client_env
+// to event_sink as an Arrow IPC stream (arrow_ipc.h), one TABLE_DATA event
+// per message. numeric, integer and Date-as-integer columns are sent straight
+// out of R's memory, the rest is converted batch by batch. the response is
+// FAILURE_R_VIEW_ERROR with the reason if the variable isn't a data frame,
+// the DONE event is left to the caller. R thread only
+//
+// the stream goes out as fast as the client reads it, through the task's
+// credit in task_control. the task waits for its client for at most a
+// minute over the whole stream, then it ends with FAILURE_TIMEOUT. a
+// cancelled task stops before its next message, CANCELLED
+//
+// with sort keys or filters the rows come from a view of the data frame.
+// sort orders, filter results and the last view are cached per variable and
+// reused until the columns they were built from change
+std::unique_ptr<RResponse> view_table(const TableViewPayload &payload,
+                                      std::string task_uuid,
+                                      OutputEventSink &event_sink,
+                                      RTaskControl &task_control);
+
+// R code ran and may have changed any data frame, the cached views are
+// checked against their columns before they are used again. R thread only
+void mark_table_views_stale();
+
+} // namespace RWorker
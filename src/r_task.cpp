@@ -1,5 +1,6 @@
 #include <r_task.h>
 
+#include <algorithm>
 #include <chrono>
 #include <iomanip>
 #include <random>
@@ -22,20 +23,42 @@ std::string generate_uuid_for_rtask() {
 }
 
 RTask::RTask(TaskType type, TaskData data)
-    : uuid_(generate_uuid_for_rtask()), type_(type), data_(std::move(data)) {}
+    : uuid_(generate_uuid_for_rtask()), type_(type), data_(std::move(data)),
+      task_class_(default_task_class(type)),
+      created_at_(std::chrono::steady_clock::now()) {}
+
+RTask::RTask(std::string uuid, TaskType type, TaskData data,
+             std::chrono::steady_clock::time_point created_at)
+    : uuid_(std::move(uuid)), type_(type), data_(std::move(data)),
+      task_class_(default_task_class(type)), created_at_(created_at) {}
 
 // factory constructors, public
-std::unique_ptr<RTask> RTask::create_client_r_code_task(std::string r_code) {
+std::unique_ptr<RTask>
+RTask::create_client_r_code_task(std::string r_code,
+                                 PlotFormatPolicy plot_policy,
+                                 std::chrono::milliseconds timeout,
+                                 OutputLimits output_limits) {
   // new RTask(...) calls the private constructor, which is allowed for static
   // members.
-  return std::unique_ptr<RTask>(new RTask(TaskType::EXECUTE_R_CODE_CLIENT,
-                                          RCodePayload{std::move(r_code)}));
+  return std::unique_ptr<RTask>(
+      new RTask(TaskType::EXECUTE_R_CODE_CLIENT,
+                RCodePayload{std::move(r_code), plot_policy, timeout,
+                             output_limits}));
+}
+
+std::unique_ptr<RTask>
+RTask::create_client_r_code_batch_task(RCodeBatchPayload batch) {
+  return std::unique_ptr<RTask>(
+      new RTask(TaskType::EXECUTE_R_CODE_BATCH, std::move(batch)));
 }
 
 std::unique_ptr<RTask>
-RTask::create_management_r_code_task(std::string r_code) {
-  return std::unique_ptr<RTask>(new RTask(TaskType::EXECUTE_R_CODE_MANAGEMENT,
-                                          RCodePayload{std::move(r_code)}));
+RTask::create_management_r_code_task(std::string r_code,
+                                     std::chrono::milliseconds timeout) {
+  // no plots or console output, only the timeout of the payload is used
+  return std::unique_ptr<RTask>(new RTask(
+      TaskType::EXECUTE_R_CODE_MANAGEMENT,
+      RCodePayload{std::move(r_code), PlotFormatPolicy::DEFAULT, timeout}));
 }
 
 std::unique_ptr<RTask>
@@ -46,10 +69,32 @@ RTask::create_cpp_management_task(std::string command_id,
       CppManagementPayload{std::move(command_id), std::move(arguments)}));
 }
 
+std::unique_ptr<RTask>
+RTask::create_table_view_task(TableViewPayload table_view) {
+  return std::unique_ptr<RTask>(
+      new RTask(TaskType::VIEW_TABLE, std::move(table_view)));
+}
+
+std::unique_ptr<RTask>
+RTask::restore_task(std::string uuid, TaskType type, TaskData data,
+                    std::chrono::steady_clock::time_point created_at) {
+  return std::unique_ptr<RTask>(
+      new RTask(std::move(uuid), type, std::move(data), created_at));
+}
+
+uint32_t RTask::get_cost() const {
+  if (const auto *batch = std::get_if<RCodeBatchPayload>(&data_)) {
+    return std::max<uint32_t>(static_cast<uint32_t>(batch->snippets.size()),
+                              1);
+  }
+  return 1;
+}
+
 // overload for debug printing / logging
 std::ostream &operator<<(std::ostream &os, const RTask &task) {
   os << "RTask {" << std::endl;
   os << "  UUID: " << task.uuid_ << std::endl;
+  os << "  Session: \"" << task.session_id_ << "\"" << std::endl;
 
   os << "  Type: ";
   switch (task.type_) {
@@ -62,6 +107,12 @@ std::ostream &operator<<(std::ostream &os, const RTask &task) {
   case TaskType::CPP_MANAGEMENT_TASK:
     os << "CPP_MANAGEMENT_TASK";
     break;
+  case TaskType::VIEW_TABLE:
+    os << "VIEW_TABLE";
+    break;
+  case TaskType::EXECUTE_R_CODE_BATCH:
+    os << "EXECUTE_R_CODE_BATCH";
+    break;
   default:
     // Print the underlying integer value if the enum value is not recognized
     os << "UNKNOWN_TASK_TYPE (value: " << static_cast<int>(task.type_) << ")";
@@ -98,6 +149,21 @@ std::ostream &operator<<(std::ostream &os, const RTask &task) {
           }
           os << "]" << std::endl;
           os << "    }" << std::endl;
+        } else if constexpr (std::is_same_v<T, TableViewPayload>) {
+          os << "    TableViewPayload: {" << std::endl;
+          os << "      Variable: \"" << payload.variable << "\"" << std::endl;
+          os << "      Rows: " << payload.offset << " + " << payload.max_rows
+             << " (batches of " << payload.batch_rows << ")" << std::endl;
+          os << "      Sort keys: " << payload.sort.size()
+             << ", filters: " << payload.filters.size() << std::endl;
+          os << "    }" << std::endl;
+        } else if constexpr (std::is_same_v<T, RCodeBatchPayload>) {
+          os << "    RCodeBatchPayload: {" << std::endl;
+          os << "      Snippets: " << payload.snippets.size()
+             << (payload.stop_on_error ? ", stop on error"
+                                       : ", continue on error")
+             << std::endl;
+          os << "    }" << std::endl;
         }
         // No 'else' branch is needed here because std::visit guarantees that
         // 'payload' will be one of the types specified in the TaskData variant.
@@ -1,6 +1,11 @@
 #pragma once
 
+#include "r_result.h"
+
+#include <chrono>
+#include <cstdint>
 #include <memory>
+#include <optional>
 #include <ostream>
 #include <string>
 #include <variant>
@@ -49,26 +54,52 @@
 
 namespace RWorker {
 
-enum class TaskType {
-  EXECUTE_R_CODE_CLIENT,
-  EXECUTE_R_CODE_MANAGEMENT,
-  CPP_MANAGEMENT_TASK
-};
+// the class a task of this type is scheduled in unless it asks for another
+constexpr TaskClass default_task_class(TaskType type) {
+  switch (type) {
+  case TaskType::CPP_MANAGEMENT_TASK:
+    return TaskClass::CONTROL;
+  case TaskType::EXECUTE_R_CODE_MANAGEMENT:
+  case TaskType::VIEW_TABLE:
+    return TaskClass::INTERACTIVE;
+  case TaskType::EXECUTE_R_CODE_CLIENT:
+  case TaskType::EXECUTE_R_CODE_BATCH:
+  default:
+    return TaskClass::CLIENT;
+  }
+}
 
 struct RCodePayload {
   std::string code;
+  PlotFormatPolicy plot_policy = PlotFormatPolicy::DEFAULT;
+  // the evaluation is interrupted once it has run this long, zero for no
+  // limit. time spent queued doesn't count
+  std::chrono::milliseconds timeout = std::chrono::milliseconds::zero();
+  // console output kept in the response
+  OutputLimits output_limits = {};
   // in the future might consider some further options:
   // e.g. bool expect_graphics_output, std::string plot_theme
 };
 
+// client code snippets, run in order in the same session like separate
+// EXECUTE_R_CODE_CLIENT tasks would be, without anything else running in
+// between. the output comes back as one RClientOutputPayload with a
+// SnippetResult per snippet
+struct RCodeBatchPayload {
+  std::vector<std::string> snippets;
+  // the snippets after a failed one are SKIPPED, otherwise they still run.
+  // a cancelled or timed out snippet always stops the batch
+  bool stop_on_error = true;
+  PlotFormatPolicy plot_policy = PlotFormatPolicy::DEFAULT;
+  // of the whole batch, zero for no limit
+  std::chrono::milliseconds timeout = std::chrono::milliseconds::zero();
+  // per snippet
+  OutputLimits output_limits = {};
+};
+
 struct CppManagementPayload {
+  // a name from the command table, see r_cpp_commands.h
   std::string command_identifier;
-  // in future might be more expicit about the above, make it an enum as well?
-  // flexible for now because don't know exactly what might go here
-  // Need to brainstorm:
-  // - echo - for testing, sends back the first string in arguments or error if
-  // empty
-  //
   std::vector<std::string> arguments;
   // could use the above for more flexible processing, even with enum
   // just opens the door for failure/parsing mistakes
@@ -76,33 +107,150 @@ struct CppManagementPayload {
   // having to split them
 };
 
-using TaskData = std::variant<RCodePayload, CppManagementPayload>;
+struct TableSortKey {
+  std::string column;
+  bool descending = false;
+};
+
+enum class TableFilterOp : uint8_t {
+  EQUAL,
+  NOT_EQUAL,
+  LESS,
+  LESS_EQUAL,
+  GREATER,
+  GREATER_EQUAL,
+  // substring, text and factor columns only
+  CONTAINS,
+  IS_NA,
+  NOT_NA,
+};
+
+struct TableFilter {
+  std::string column;
+  TableFilterOp op = TableFilterOp::EQUAL;
+  // parsed as the column's type, unused for IS_NA/NOT_NA
+  std::string value;
+};
+
+// rows [offset, offset + max_rows) of the data frame `variable` in client_env,
+// in record batches of at most batch_rows rows. with sort keys or filters the
+// rows are those of the sorted and filtered view (see r_table_view.h)
+struct TableViewPayload {
+  std::string variable;
+  uint64_t offset = 0;
+  // zero for all rows from offset on
+  uint64_t max_rows = 0;
+  uint64_t batch_rows = 64 * 1024;
+  // in priority order, rows that tie on all of them keep their order
+  std::vector<TableSortKey> sort = {};
+  // a row is in the view if it passes all of them
+  std::vector<TableFilter> filters = {};
+};
+
+using TaskData = std::variant<RCodePayload, CppManagementPayload,
+                              TableViewPayload, RCodeBatchPayload>;
 
 class RTask {
 public:
   // factory constructors
-  static std::unique_ptr<RTask> create_client_r_code_task(std::string r_code);
+  static std::unique_ptr<RTask> create_client_r_code_task(
+      std::string r_code,
+      PlotFormatPolicy plot_policy = PlotFormatPolicy::DEFAULT,
+      std::chrono::milliseconds timeout = std::chrono::milliseconds::zero(),
+      OutputLimits output_limits = {});
   static std::unique_ptr<RTask>
-  create_management_r_code_task(std::string r_code);
+  create_client_r_code_batch_task(RCodeBatchPayload batch);
+  static std::unique_ptr<RTask> create_management_r_code_task(
+      std::string r_code,
+      std::chrono::milliseconds timeout = std::chrono::milliseconds::zero());
   static std::unique_ptr<RTask>
   create_cpp_management_task(std::string command_id,
                              std::vector<std::string> arguments = {});
+  static std::unique_ptr<RTask>
+  create_table_view_task(TableViewPayload table_view);
+  // rebuilds a task that already has a uuid, only for the IPC layer
+  // (r_ipc.cpp) on the worker process side
+  static std::unique_ptr<RTask>
+  restore_task(std::string uuid, TaskType type, TaskData data,
+               std::chrono::steady_clock::time_point created_at);
 
   const std::string &get_uuid() const { return uuid_; }
   TaskType get_type() const { return type_; }
   const TaskData &get_data() const { return data_; }
 
+  // session the task belongs to, decides which R worker process runs it.
+  // empty is the default session
+  const std::string &get_session_id() const { return session_id_; }
+  void set_session_id(std::string session_id) {
+    session_id_ = std::move(session_id);
+  }
+
+  // who submitted the task, from the request's metadata, the session if it
+  // didn't say. the worker's scheduler takes turns between clients, weight
+  // tasks per turn
+  const std::string &get_client_id() const { return client_id_; }
+  uint32_t get_client_weight() const { return client_weight_; }
+  void set_client(std::string client_id, uint32_t weight) {
+    client_id_ = std::move(client_id);
+    client_weight_ = weight;
+  }
+
+  // which of the worker's queues the task waits in, default_task_class() of
+  // its type unless set
+  TaskClass get_task_class() const { return task_class_; }
+  void set_task_class(TaskClass task_class) { task_class_ = task_class; }
+
+  // what the task is charged against its client's turns and queue depth:
+  // its number of snippets for a batch, one for anything else
+  uint32_t get_cost() const;
+
+  // when the front-end created the task, its queue wait counts from here.
+  // steady_clock is CLOCK_MONOTONIC, which every process on the machine
+  // shares, so this still means the same in the worker process
+  std::chrono::steady_clock::time_point get_created_at() const {
+    return created_at_;
+  }
+
+  // the client's gRPC deadline, if it waits on the call for the result. a
+  // task still queued when it passes is dropped by the worker (EXPIRED)
+  const std::optional<std::chrono::steady_clock::time_point> &
+  get_client_deadline() const {
+    return client_deadline_;
+  }
+  void set_client_deadline(
+      std::optional<std::chrono::steady_clock::time_point> client_deadline) {
+    client_deadline_ = client_deadline;
+  }
+
+  // optional sink that receives output while the task runs (streaming),
+  // null for the normal submit + poll flow
+  const std::shared_ptr<OutputEventSink> &get_event_sink() const {
+    return event_sink_;
+  }
+  void set_event_sink(std::shared_ptr<OutputEventSink> event_sink) {
+    event_sink_ = std::move(event_sink);
+  }
+
   // overload for debug printing/logging, necessary for access to private vars
   friend std::ostream &operator<<(std::ostream &os, const RTask &task);
 
 private:
   // private ctor to force use of the factory methods
   RTask(TaskType type, TaskData data);
+  RTask(std::string uuid, TaskType type, TaskData data,
+        std::chrono::steady_clock::time_point created_at);
 
   // member vars
   std::string uuid_;
   TaskType type_;
   TaskData data_;
+  std::string session_id_;
+  std::string client_id_;
+  uint32_t client_weight_ = 1;
+  TaskClass task_class_;
+  std::chrono::steady_clock::time_point created_at_;
+  std::optional<std::chrono::steady_clock::time_point> client_deadline_;
+  std::shared_ptr<OutputEventSink> event_sink_;
 };
 
 std::ostream &operator<<(std::ostream &os, const RTask &task);
@@ -0,0 +1,198 @@
+#include "r_task_control.h"
+#include "r_ipc.h"
+
+#include <cerrno>
+#include <csignal>
+#include <cstring>
+#include <iostream>
+#include <unistd.h>
+
+// R's own flag, what its SIGINT handler sets. exported by libR, declared
+// here instead of pulling the R headers into this file
+extern "C" int R_interrupts_pending;
+
+namespace RWorker {
+
+namespace {
+
+// sent to the R thread to get it out of a blocking syscall. R's own signal
+// handlers are off (R_SignalHandlers = 0), so this one is ours
+constexpr int wake_signal = SIGUSR1;
+
+// only there so the signal interrupts the syscall (EINTR) instead of killing
+// the process. R_interrupts_pending is already set by then
+void handle_wake_signal(int) {}
+
+} // namespace
+
+RTaskControl::RTaskControl() : r_thread_(pthread_self()) {
+  struct sigaction action;
+  std::memset(&action, 0, sizeof(action));
+  action.sa_handler = handle_wake_signal;
+  sigemptyset(&action.sa_mask);
+  // no SA_RESTART, the point is to make select()/read() return
+  action.sa_flags = 0;
+  if (sigaction(wake_signal, &action, nullptr) != 0) {
+    std::cerr << "R worker " << getpid()
+              << ": could not install the interrupt wake-up handler: "
+              << std::strerror(errno) << std::endl;
+  }
+
+  watchdog_ = std::jthread(
+      [this](std::stop_token stop_token) { watch_deadlines(stop_token); });
+}
+
+RTaskControl::~RTaskControl() {
+  // condition_variable_any's stop_token waits wake up on request_stop()
+  watchdog_.request_stop();
+  watchdog_.join();
+}
+
+void RTaskControl::task_queued(const std::string &task_uuid) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  queued_.insert(task_uuid);
+}
+
+bool RTaskControl::cancel(const std::string &task_uuid) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (!running_.empty() && running_ == task_uuid) {
+    interrupt_locked(InterruptReason::CANCELLED);
+    return true;
+  }
+  if (queued_.contains(task_uuid)) {
+    cancelled_.insert(task_uuid);
+    return true;
+  }
+  return false;
+}
+
+bool RTaskControl::abandon(const std::string &task_uuid) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (!queued_.contains(task_uuid)) {
+    return false;
+  }
+  abandoned_.insert(task_uuid);
+  return true;
+}
+
+TaskStart RTaskControl::start_task(
+    const std::string &task_uuid, std::chrono::milliseconds timeout,
+    std::optional<std::chrono::steady_clock::time_point> client_deadline) {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    queued_.erase(task_uuid);
+    bool abandoned = abandoned_.erase(task_uuid) != 0;
+    if (cancelled_.erase(task_uuid) != 0) {
+      return TaskStart::CANCELLED;
+    }
+    if (abandoned || (client_deadline.has_value() &&
+                      std::chrono::steady_clock::now() >= *client_deadline)) {
+      return TaskStart::EXPIRED;
+    }
+    running_ = task_uuid;
+    reason_ = InterruptReason::NONE;
+    credit_ = static_cast<int64_t>(table_stream_window_bytes);
+    if (timeout > std::chrono::milliseconds::zero()) {
+      deadline_ = std::chrono::steady_clock::now() + timeout;
+    }
+  }
+  if (timeout > std::chrono::milliseconds::zero()) {
+    deadline_changed_.notify_one();
+  }
+  return TaskStart::RUN;
+}
+
+void RTaskControl::finish_task() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  running_.clear();
+  // the watchdog notices on its own when it wakes up, no need to notify
+  deadline_.reset();
+  interruptible_ = false;
+  reason_ = InterruptReason::NONE;
+}
+
+InterruptReason RTaskControl::interrupt_reason() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return reason_;
+}
+
+void RTaskControl::add_credit(const std::string &task_uuid, uint64_t bytes) {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (running_.empty() || running_ != task_uuid) {
+      return;
+    }
+    credit_ += static_cast<int64_t>(bytes);
+  }
+  credit_changed_.notify_one();
+}
+
+bool RTaskControl::wait_for_credit(
+    uint64_t bytes, std::chrono::steady_clock::time_point deadline) {
+  std::unique_lock<std::mutex> lock(mutex_);
+  credit_changed_.wait_until(lock, deadline, [this] {
+    return credit_ > 0 || reason_ != InterruptReason::NONE;
+  });
+  if (credit_ <= 0 || reason_ != InterruptReason::NONE) {
+    return false;
+  }
+  credit_ -= static_cast<int64_t>(bytes);
+  return true;
+}
+
+void RTaskControl::begin_interruptible() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  interruptible_ = true;
+  if (reason_ != InterruptReason::NONE) {
+    // came in before the section, on the R thread already, no need to wake
+    // it up
+    R_interrupts_pending = 1;
+  }
+}
+
+void RTaskControl::end_interruptible() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  interruptible_ = false;
+  if (reason_ != InterruptReason::NONE) {
+    // the evaluation may have ended before R looked at the flag, what comes
+    // after it must not be interrupted
+    R_interrupts_pending = 0;
+  }
+}
+
+void RTaskControl::interrupt_locked(InterruptReason reason) {
+  // already on its way, the first reason is the one reported
+  if (reason_ != InterruptReason::NONE) {
+    return;
+  }
+  reason_ = reason;
+  // a VIEW_TABLE task waiting for its client stops waiting
+  credit_changed_.notify_one();
+  if (interruptible_) {
+    R_interrupts_pending = 1;
+    pthread_kill(r_thread_, wake_signal);
+  }
+}
+
+void RTaskControl::watch_deadlines(std::stop_token stop_token) {
+  std::unique_lock<std::mutex> lock(mutex_);
+  while (!stop_token.stop_requested()) {
+    if (!deadline_.has_value()) {
+      deadline_changed_.wait(lock, stop_token,
+                             [this] { return deadline_.has_value(); });
+      continue;
+    }
+
+    // a new task's deadline, or none, ends the wait early
+    std::chrono::steady_clock::time_point deadline = *deadline_;
+    bool changed = deadline_changed_.wait_until(
+        lock, stop_token, deadline,
+        [this, deadline] { return deadline_ != deadline; });
+    if (!changed && !stop_token.stop_requested() && deadline_ == deadline) {
+      deadline_.reset();
+      interrupt_locked(InterruptReason::TIMED_OUT);
+    }
+  }
+}
+
+} // namespace RWorker
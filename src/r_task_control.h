@@ -0,0 +1,174 @@
+#pragma once
+
+#include <absl/base/thread_annotations.h>
+#include <absl/container/flat_hash_set.h>
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <optional>
+#include <pthread.h>
+#include <stop_token>
+#include <string>
+#include <thread>
+
+// stopping tasks of an R worker process from other threads
+//
+// the reader thread registers every task it queues and forwards CANCEL
+// frames here. a task that is still queued is only marked, the R thread
+// skips it when it gets to it. a task that is running is interrupted the way
+// a SIGINT would interrupt R: R_interrupts_pending is set, and R raises an
+// interrupt condition the next time it checks for one (R_CheckUserInterrupt,
+// every so many evals and inside most of its own waits). the R thread is also
+// sent a signal so that a blocking syscall (select() in Sys.sleep, a read)
+// returns early and gets to that check.
+//
+// tasks whose client stopped waiting (ABANDON frame, or its deadline passed)
+// are dropped when they come off the queue, they are not interrupted once
+// they run.
+//
+// a task with a timeout is interrupted the same way by a watchdog thread once
+// its deadline passes.
+//
+// R is only interrupted inside an interruptible section, the R thread marks
+// the part of a task that runs client code with one (InterruptibleSection).
+// a cancel or timeout that comes in outside of it is still reported for the
+// task, but R isn't interrupted: before the section the interrupt waits for
+// it to begin, after it (collecting and rendering the output, which has to
+// go through R too) the task finishes with what it has.
+//
+// C code that never calls R_CheckUserInterrupt can't be interrupted like
+// this, the task is only stopped once that call returns
+//
+// a VIEW_TABLE task's stream is paced by its client: the reader thread adds
+// the CREDIT frames of the running task here and the R thread waits for
+// them before it sends more (see table_stream_window_bytes in r_ipc.h)
+
+namespace RWorker {
+
+enum class InterruptReason {
+  NONE,
+  // CancelEvalOperation
+  CANCELLED,
+  // the task ran past its timeout
+  TIMED_OUT,
+};
+
+// what the R thread should do with a task it took off the queue
+enum class TaskStart {
+  RUN,
+  // cancelled while queued
+  CANCELLED,
+  // its client stopped waiting for it while it was queued
+  EXPIRED,
+};
+
+class RTaskControl {
+public:
+  // constructed on the R thread, which is the one interrupts are sent to.
+  // installs the (empty) handler for the wake-up signal and starts the
+  // watchdog thread
+  RTaskControl();
+  ~RTaskControl();
+
+  RTaskControl(const RTaskControl &) = delete;
+  RTaskControl &operator=(const RTaskControl &) = delete;
+
+  // reader thread, before the task goes on the task queue
+  void task_queued(const std::string &task_uuid);
+
+  // any thread. false if the task is neither queued nor running (unknown,
+  // or already finished)
+  bool cancel(const std::string &task_uuid);
+  // any thread. the client of the task went away, false if the task isn't
+  // queued (a running task is left to finish)
+  bool abandon(const std::string &task_uuid);
+
+  // R thread, when the task comes off the queue. only a task that gets RUN
+  // may run, and it has to be finished with finish_task(). a timeout of zero
+  // means none, otherwise the task is interrupted once it has run that long
+  TaskStart start_task(
+      const std::string &task_uuid,
+      std::chrono::milliseconds timeout = std::chrono::milliseconds::zero(),
+      std::optional<std::chrono::steady_clock::time_point> client_deadline =
+          std::nullopt);
+  // R thread, once the task is over. forgets its interrupt, if it had one, so
+  // it can't hit the next task
+  void finish_task();
+
+  // R thread, why the running task was interrupted, NONE if it wasn't
+  InterruptReason interrupt_reason() const;
+
+  // reader thread, CREDIT frame. ignored unless the task is running
+  void add_credit(const std::string &task_uuid, uint64_t bytes);
+  // R thread, before the running task sends bytes more of its stream. waits
+  // until it has credit left, table_stream_window_bytes when it starts, and
+  // takes bytes of it. a message bigger than what is left still goes out
+  // whole, the credit is negative until the client caught up. false, and
+  // nothing taken, if the task is interrupted or deadline passes first
+  bool wait_for_credit(uint64_t bytes,
+                       std::chrono::steady_clock::time_point deadline);
+
+  // R thread, around the evaluation of client code of the running task. an
+  // interrupt that came in before the section begins is raised right away,
+  // one that R hasn't got to by the end of it is dropped
+  void begin_interruptible();
+  void end_interruptible();
+
+private:
+  void interrupt_locked(InterruptReason reason)
+      ABSL_EXCLUSIVE_LOCKS_REQUIRED(mutex_);
+  // sleeps until the running task's deadline, interrupts it if it is still
+  // running by then
+  void watch_deadlines(std::stop_token stop_token);
+
+  const pthread_t r_thread_;
+
+  mutable std::mutex mutex_;
+  absl::flat_hash_set<std::string> queued_ ABSL_GUARDED_BY(mutex_);
+  absl::flat_hash_set<std::string> cancelled_ ABSL_GUARDED_BY(mutex_);
+  absl::flat_hash_set<std::string> abandoned_ ABSL_GUARDED_BY(mutex_);
+  // empty while idle
+  std::string running_ ABSL_GUARDED_BY(mutex_);
+  InterruptReason reason_ ABSL_GUARDED_BY(mutex_) = InterruptReason::NONE;
+  // between begin_interruptible() and end_interruptible()
+  bool interruptible_ ABSL_GUARDED_BY(mutex_) = false;
+  // of the running task, if it has a timeout
+  std::optional<std::chrono::steady_clock::time_point>
+      deadline_ ABSL_GUARDED_BY(mutex_);
+  // wakes the watchdog when a deadline is set or cleared
+  std::condition_variable_any deadline_changed_;
+  // of the running task, see wait_for_credit()
+  int64_t credit_ ABSL_GUARDED_BY(mutex_) = 0;
+  // wakes wait_for_credit() on credit or an interrupt
+  std::condition_variable credit_changed_;
+
+  // last, it uses everything above
+  std::jthread watchdog_;
+};
+
+// an interruptible section for the lifetime of the object, also ended when R
+// unwinds out of it. null task_control means nothing can interrupt the task
+class InterruptibleSection {
+public:
+  explicit InterruptibleSection(RTaskControl *task_control)
+      : task_control_(task_control) {
+    if (task_control_ != nullptr) {
+      task_control_->begin_interruptible();
+    }
+  }
+  ~InterruptibleSection() {
+    if (task_control_ != nullptr) {
+      task_control_->end_interruptible();
+    }
+  }
+
+  InterruptibleSection(const InterruptibleSection &) = delete;
+  InterruptibleSection &operator=(const InterruptibleSection &) = delete;
+
+private:
+  RTaskControl *task_control_;
+};
+
+} // namespace RWorker
@@ -0,0 +1,114 @@
+#include "r_task_scheduler.h"
+
+#include <algorithm>
+#include <utility>
+
+namespace RWorker {
+
+std::chrono::steady_clock::time_point
+RTaskScheduler::ClassQueue::oldest_queued_at() const {
+  auto oldest = std::chrono::steady_clock::time_point::max();
+  for (const auto &[client_id, client] : clients) {
+    oldest = std::min(oldest, client.tasks.front().queued_at);
+  }
+  return oldest;
+}
+
+std::unique_ptr<RTask> RTaskScheduler::ClassQueue::pop() {
+  // the front client's turn goes on while its deficit covers its next task.
+  // one that can't afford it keeps the deficit for its next turn, a batch
+  // costing more than the weight waits a few rounds
+  auto it = clients.find(turns.front());
+  while (true) {
+    ClientQueue &client = it->second;
+    if (!client.in_turn) {
+      client.deficit += client.weight;
+      client.in_turn = true;
+    }
+    if (client.deficit >= client.tasks.front().cost) {
+      break;
+    }
+    client.in_turn = false;
+    std::string client_id = std::move(turns.front());
+    turns.pop_front();
+    turns.push_back(std::move(client_id));
+    it = clients.find(turns.front());
+  }
+
+  ClientQueue &client = it->second;
+  client.deficit -= client.tasks.front().cost;
+  std::unique_ptr<RTask> task = std::move(client.tasks.front().task);
+  client.tasks.pop_front();
+
+  if (client.tasks.empty()) {
+    // nothing saved up for later, an idle client starts over
+    clients.erase(it);
+    turns.pop_front();
+  }
+  return task;
+}
+
+void RTaskScheduler::push(std::unique_ptr<RTask> task) {
+  auto task_class = static_cast<std::size_t>(task->get_task_class());
+  if (task_class >= num_task_classes) {
+    task_class = static_cast<std::size_t>(TaskClass::CLIENT);
+  }
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    ClassQueue &queue = queues_[task_class];
+    auto [it, inserted] = queue.clients.try_emplace(task->get_client_id());
+    if (inserted) {
+      queue.turns.push_back(it->first);
+    }
+    it->second.weight = std::max<uint32_t>(task->get_client_weight(), 1);
+    uint32_t cost = task->get_cost();
+    it->second.tasks.push_back(QueuedTask{
+        std::move(task), std::chrono::steady_clock::now(), cost});
+    ++size_;
+  }
+  task_queued_.notify_one();
+}
+
+bool RTaskScheduler::wait_pop(std::unique_ptr<RTask> &task,
+                              std::chrono::milliseconds timeout) {
+  std::unique_lock<std::mutex> lock(mutex_);
+  if (!task_queued_.wait_for(lock, timeout, [this] { return size_ > 0; })) {
+    return false;
+  }
+
+  task = queues_[next_class(std::chrono::steady_clock::now())].pop();
+  --size_;
+  return true;
+}
+
+std::size_t
+RTaskScheduler::next_class(std::chrono::steady_clock::time_point now) {
+  // the lowest class past its limit first, it has been passed over longest.
+  // never twice in a row, a backlog that is starved as a whole would take
+  // over otherwise
+  if (!promoted_last_) {
+    for (std::size_t i = num_task_classes; i-- > 0;) {
+      if (!queues_[i].empty() &&
+          starvation_after_[i] > std::chrono::milliseconds::zero() &&
+          now - queues_[i].oldest_queued_at() >= starvation_after_[i]) {
+        // only counts as a promotion if it jumped a higher class
+        for (std::size_t j = 0; j < i; ++j) {
+          if (!queues_[j].empty()) {
+            promoted_last_ = true;
+            return i;
+          }
+        }
+        return i;
+      }
+    }
+  }
+  promoted_last_ = false;
+  for (std::size_t i = 0; i < num_task_classes; ++i) {
+    if (!queues_[i].empty()) {
+      return i;
+    }
+  }
+  return 0;
+}
+
+} // namespace RWorker
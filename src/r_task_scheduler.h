@@ -0,0 +1,100 @@
+#pragma once
+
+#include "r_task.h"
+
+#include <absl/container/flat_hash_map.h>
+
+#include <array>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+
+namespace RWorker {
+
+// the worker process' task queue, between the reader thread and the R
+// thread. a task is taken from the highest priority TaskClass that has one,
+// so a UI probe never waits behind a backlog of client code, only behind the
+// task that is running.
+//
+// strict priority alone would let a steady stream of control and interactive
+// tasks starve client code, so a class whose oldest task has waited past its
+// starvation_after goes first. it gets every other turn until it has caught
+// up, the classes above it keep the rest.
+//
+// within a class every client (RTask::get_client_id()) has its own FIFO and
+// the clients take turns, deficit round robin charged RTask::get_cost(): one
+// per task, a batch its number of snippets. a client gets its weight per
+// round. one client queueing 500 snippets then only delays the others by its
+// weight per round, not by 500, whether they come as tasks or as batches
+class RTaskScheduler {
+public:
+  // how long the oldest task of each class may wait before it is taken ahead
+  // of higher priority classes, by TaskClass. zero never promotes
+  using StarvationLimits = std::array<std::chrono::milliseconds, num_task_classes>;
+  static constexpr StarvationLimits default_starvation_after{
+      std::chrono::milliseconds::zero(), std::chrono::milliseconds(2000),
+      std::chrono::milliseconds(5000)};
+
+  explicit RTaskScheduler(
+      StarvationLimits starvation_after = default_starvation_after)
+      : starvation_after_(starvation_after) {}
+
+  RTaskScheduler(const RTaskScheduler &) = delete;
+  RTaskScheduler &operator=(const RTaskScheduler &) = delete;
+
+  void push(std::unique_ptr<RTask> task);
+
+  // blocks until there is a task or timeout passes, false on timeout
+  bool wait_pop(std::unique_ptr<RTask> &task,
+                std::chrono::milliseconds timeout);
+
+private:
+  struct QueuedTask {
+    std::unique_ptr<RTask> task;
+    // when it got here, the starvation guard counts from this
+    std::chrono::steady_clock::time_point queued_at;
+    uint32_t cost = 1;
+  };
+
+  struct ClientQueue {
+    std::deque<QueuedTask> tasks;
+    // of the client's last task
+    uint32_t weight = 1;
+    // cost the client can still run, topped up by weight at the start of
+    // each of its turns
+    uint32_t deficit = 0;
+    // it is at the front of turns and has been topped up
+    bool in_turn = false;
+  };
+
+  struct ClassQueue {
+    // only clients with queued tasks
+    absl::flat_hash_map<std::string, ClientQueue> clients;
+    // turn order, the front client is the one being served
+    std::deque<std::string> turns;
+
+    bool empty() const { return turns.empty(); }
+    // when the longest waiting task of the class was queued
+    std::chrono::steady_clock::time_point oldest_queued_at() const;
+    // the next task in deficit round robin order
+    std::unique_ptr<RTask> pop();
+  };
+
+  // the class the next task comes from, one of them has to be non-empty
+  std::size_t next_class(std::chrono::steady_clock::time_point now);
+
+  const StarvationLimits starvation_after_;
+
+  std::mutex mutex_;
+  std::condition_variable task_queued_;
+  std::array<ClassQueue, num_task_classes> queues_;
+  std::size_t size_ = 0;
+  // the last task was a starved one taken ahead of a higher class
+  bool promoted_last_ = false;
+};
+
+} // namespace RWorker
@@ -1,14 +1,20 @@
+#include <algorithm>
 #include <chrono>
 #include <exception>
 #include <iostream>
+#include <iterator>
 #include <memory>
 #include <thread>
 
 #include "envs.h"
+#include "r_cpp_commands.h"
 #include "r_eval.h"
 #include "r_init.h"
 #include "r_result.h"
+#include "r_table_view.h"
 #include "r_task.h"
+#include "r_task_control.h"
+#include "r_task_scheduler.h"
 #include "r_worker.h"
 
 // R includes
@@ -31,6 +37,7 @@
 #endif
 
 // concurrent queue include
+#include <blockingconcurrentqueue.h>
 #include <concurrentqueue.h>
 
 // logging/check
@@ -42,10 +49,12 @@ bool is_R_init = false;
 
 using namespace moodycamel;
 
-void r_worker_thread(
-    std::stop_token stop_token,
-    ConcurrentQueue<std::unique_ptr<RTask>> &taskQueue,
-    ConcurrentQueue<std::unique_ptr<RResponse>> &responseQueue) {
+// upper bound on how long the worker blocks waiting for a task before it
+// re-checks the stop token. new tasks wake the worker immediately, this only
+// bounds how long shutdown can take while idle
+constexpr std::chrono::milliseconds task_wait_timeout(100);
+
+void init_embedded_R() {
   // set R_HOME and R_LIBS
   try {
     set_r_home(R_HOME_CMAKE);
@@ -76,58 +85,276 @@ void r_worker_thread(
   if (!exec_R_setup()) {
     throw std::logic_error("R setup snippets did not run correctly");
   }
+}
 
-  while (!stop_token.stop_requested()) {
-    // TODO: actually write task handling
-    std::unique_ptr<RTask> task;
+namespace {
 
-    if (taskQueue.try_dequeue(task)) {
-      // std::cout << "R thread: time: "
-      //          << std::chrono::high_resolution_clock().now() << std::endl;
-
-      if (task.get()) {
-        // std::cout << "Valid ptr" << std::endl;
-        // std::cout << *task << std::endl;
-
-        switch (task->get_type()) {
-        case TaskType::EXECUTE_R_CODE_CLIENT: {
-          std::string task_uuid = task->get_uuid();
-          TaskData task_data = task->get_data();
-
-          std::string r_code = std::get<RCodePayload>(task_data).code;
-
-          std::unique_ptr<RResponse> client_eval_response =
-              eval_client_R(r_code, task_uuid);
-
-          responseQueue.enqueue(std::move(client_eval_response));
-          break;
-        }
-        case TaskType::EXECUTE_R_CODE_MANAGEMENT:
-          break;
-        case TaskType::CPP_MANAGEMENT_TASK:
-          break;
-        default:
-          // should be unreachable
-          CHECK(false) << "RTask of unknown type";
-          break;
-        }
-
-      } else {
-        // use abseil check for invariant
-        CHECK(task.get()) << "RTask dequeue unique_ptr null";
-      }
+// runs a task through task_control: run() does the work if the task gets to
+// run, a task that doesn't gets its CANCELLED/EXPIRED response here.
+// cancelled_payload is what a task cancelled while queued reports. the
+// response comes back with the task's timing
+template <typename Run>
+std::unique_ptr<RResponse>
+run_task(const RTask &task, RTaskControl &task_control,
+         std::chrono::milliseconds timeout, ResultData cancelled_payload,
+         Run run) {
+  const std::string &task_uuid = task.get_uuid();
+  const std::optional<std::chrono::steady_clock::time_point> &client_deadline =
+      task.get_client_deadline();
+  auto start_time = std::chrono::steady_clock::now();
+  TaskTiming timing;
+  timing.task_class = task.get_task_class();
+  timing.queue_wait = std::chrono::duration_cast<std::chrono::microseconds>(
+      start_time - task.get_created_at());
+
+  std::unique_ptr<RResponse> response;
+  switch (task_control.start_task(task_uuid, timeout, client_deadline)) {
+  case TaskStart::RUN: {
+    response = run();
+    task_control.finish_task();
 
-      // if there was a task, we continue to grab the next immediately
-      // if not we wait for 1 second
+    auto end_time = std::chrono::steady_clock::now();
+    timing.run_time = std::chrono::duration_cast<std::chrono::microseconds>(
+        end_time - start_time);
+    timing.finished_past_deadline =
+        client_deadline.has_value() && end_time > *client_deadline;
+    break;
+  }
+  case TaskStart::CANCELLED:
+    // cancelled while it was queued, never started
+    response = std::make_unique<RResponse>(task_uuid, ResponseStatus::CANCELLED,
+                                           std::move(cancelled_payload));
+    break;
+  case TaskStart::EXPIRED:
+    // nobody is waiting for the result anymore, don't bother
+    response = std::make_unique<RResponse>(
+        task_uuid, ResponseStatus::EXPIRED, std::monostate{},
+        "Dropped before it ran, the client's deadline passed or it "
+        "went away while the task was queued");
+    break;
+  }
+  response->set_timing(timing);
+  response->set_task_type(task.get_type());
+  return response;
+}
+
+// runs the snippets of a batch one after the other, each like an
+// EXECUTE_R_CODE_CLIENT task, and puts their output together. the batch
+// has the status of its first snippet that didn't succeed
+std::unique_ptr<RResponse>
+eval_client_R_batch(RCodeBatchPayload &batch, const std::string &task_uuid,
+                    const std::shared_ptr<OutputEventSink> &event_sink,
+                    PlotRenderPool *render_pool,
+                    RTaskControl &task_control) {
+  RClientOutputPayload output;
+  output.plot_policy = batch.plot_policy;
+  output.snippets.reserve(batch.snippets.size());
+  ResponseStatus batch_status = ResponseStatus::SUCCESS;
+  bool stopped = false;
+
+  for (std::string &code : batch.snippets) {
+    SnippetResult &snippet = output.snippets.emplace_back();
+    snippet.first_line = output.console_output.size();
+    snippet.first_plot = output.graphic_output.size();
+    // a cancel or timeout that came in between snippets stops the rest too
+    if (stopped || task_control.interrupt_reason() != InterruptReason::NONE) {
       continue;
     }
 
-    // artificial slowdown for debug
-    std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    auto start_time = std::chrono::steady_clock::now();
+    std::unique_ptr<RResponse> response =
+        eval_client_R(std::move(code), task_uuid, event_sink, render_pool,
+                      batch.plot_policy, &task_control, batch.output_limits);
+    snippet.run_time = std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now() - start_time);
+    snippet.status = response->get_status();
+
+    ResultData result = response->take_result_payload();
+    if (auto *snippet_output = std::get_if<RClientOutputPayload>(&result)) {
+      snippet.num_lines = snippet_output->console_output.size();
+      snippet.num_plots = snippet_output->graphic_output.size();
+      snippet.console_sizes = snippet_output->console_sizes;
+      std::move(snippet_output->console_output.begin(),
+                snippet_output->console_output.end(),
+                std::back_inserter(output.console_output));
+      std::move(snippet_output->graphic_output.begin(),
+                snippet_output->graphic_output.end(),
+                std::back_inserter(output.graphic_output));
+
+      ConsoleOutputSizes &sizes = output.console_sizes;
+      sizes.total_lines += snippet.console_sizes.total_lines;
+      sizes.total_bytes += snippet.console_sizes.total_bytes;
+      sizes.retained_lines += snippet.console_sizes.retained_lines;
+      sizes.retained_bytes += snippet.console_sizes.retained_bytes;
+      sizes.truncated = sizes.truncated || snippet.console_sizes.truncated;
+    }
+
+    if (snippet.status != ResponseStatus::SUCCESS) {
+      if (batch_status == ResponseStatus::SUCCESS) {
+        batch_status = snippet.status;
+      }
+      // only an R error lets the batch go on, if it is allowed to
+      stopped = batch.stop_on_error ||
+                snippet.status != ResponseStatus::FAILURE_R_SCRIPT_ERROR;
+    }
+  }
+
+  return std::make_unique<RResponse>(task_uuid, batch_status,
+                                     std::move(output));
+}
+
+// the value summary or command output of a management task, or what went
+// wrong, for its DONE event
+std::string management_done_content(const RResponse &response) {
+  if (const auto *result = std::get_if<ManagementTaskResultPayload>(
+          &response.get_result_payload());
+      result != nullptr && response.is_success()) {
+    return result->result_message;
   }
+  return response.get_error_message().value_or("");
+}
 
-  // cleanup
-  Rf_endEmbeddedR(0);
+// counts the task, queues the response, then gives streaming listeners their
+// final event
+void finish_task(const RTask &task, std::unique_ptr<RResponse> response,
+                 const std::shared_ptr<OutputEventSink> &event_sink,
+                 std::string done_content, WorkerCounters &counters,
+                 BlockingConcurrentQueue<std::unique_ptr<RResponse>>
+                     &responseQueue) {
+  ResponseStatus status = response->get_status();
+  counters.count(task.get_type(), status);
+  responseQueue.enqueue(std::move(response));
+  if (event_sink) {
+    event_sink->push_event(
+        OutputEvent{OutputEventType::DONE, std::move(done_content), status});
+  }
+}
+
+} // namespace
+
+void r_worker_loop(
+    std::stop_token stop_token,
+    RTaskScheduler &scheduler,
+    BlockingConcurrentQueue<std::unique_ptr<RResponse>> &responseQueue,
+    RTaskControl &task_control, PlotRenderPool *render_pool) {
+  // for the uptime command
+  WorkerCounters counters;
+
+  while (!stop_token.stop_requested()) {
+    std::unique_ptr<RTask> task;
+
+    // blocks until a task is queued or the timeout passes, in which case we
+    // loop around to check the stop token again. the scheduler decides which
+    // of the queued tasks is next
+    if (!scheduler.wait_pop(task, task_wait_timeout)) {
+      continue;
+    }
+
+    // use abseil check for invariant
+    CHECK(task.get()) << "RTask dequeue unique_ptr null";
+
+    std::shared_ptr<OutputEventSink> event_sink = task->get_event_sink();
+
+    switch (task->get_type()) {
+    case TaskType::EXECUTE_R_CODE_CLIENT: {
+      RCodePayload code_payload = std::get<RCodePayload>(task->get_data());
+
+      std::unique_ptr<RResponse> response = run_task(
+          *task, task_control, code_payload.timeout, RClientOutputPayload{},
+          [&] {
+            std::unique_ptr<RResponse> client_eval_response = eval_client_R(
+                std::move(code_payload.code), task->get_uuid(), event_sink,
+                render_pool, code_payload.plot_policy, &task_control,
+                code_payload.output_limits);
+            mark_table_views_stale();
+            return client_eval_response;
+          });
+      finish_task(*task, std::move(response), event_sink, "", counters,
+                  responseQueue);
+      break;
+    }
+    case TaskType::EXECUTE_R_CODE_BATCH: {
+      RCodeBatchPayload batch = std::get<RCodeBatchPayload>(task->get_data());
+      // cancelled while queued, none of the snippets ran
+      RClientOutputPayload cancelled;
+      cancelled.plot_policy = batch.plot_policy;
+      cancelled.snippets.resize(batch.snippets.size());
+
+      // the timeout is the whole batch's, one task to the task control
+      std::unique_ptr<RResponse> response = run_task(
+          *task, task_control, batch.timeout, std::move(cancelled), [&] {
+            std::unique_ptr<RResponse> batch_response = eval_client_R_batch(
+                batch, task->get_uuid(), event_sink, render_pool,
+                task_control);
+            mark_table_views_stale();
+            return batch_response;
+          });
+      finish_task(*task, std::move(response), event_sink, "", counters,
+                  responseQueue);
+      break;
+    }
+    case TaskType::EXECUTE_R_CODE_MANAGEMENT: {
+      const RCodePayload &code_payload =
+          std::get<RCodePayload>(task->get_data());
+
+      std::unique_ptr<RResponse> response = run_task(
+          *task, task_control, code_payload.timeout,
+          ManagementTaskResultPayload{}, [&] {
+            std::unique_ptr<RResponse> management_response = eval_management_R(
+                code_payload.code, task->get_uuid(), &task_control);
+            mark_table_views_stale();
+            return management_response;
+          });
+      std::string done_content = management_done_content(*response);
+      finish_task(*task, std::move(response), event_sink,
+                  std::move(done_content), counters, responseQueue);
+      break;
+    }
+    case TaskType::VIEW_TABLE: {
+      const TableViewPayload &table_view =
+          std::get<TableViewPayload>(task->get_data());
+
+      // no timeout, a view runs as long as the client keeps reading. one that
+      // stops reading is given up on by view_table itself
+      std::unique_ptr<RResponse> response = run_task(
+          *task, task_control, std::chrono::milliseconds::zero(),
+          std::monostate{}, [&] {
+            if (!event_sink) {
+              // the table only ever goes out as events
+              return std::make_unique<RResponse>(
+                  task->get_uuid(), ResponseStatus::FAILURE_INVALID_TASK,
+                  std::monostate{}, "VIEW_TABLE task without an event sink");
+            }
+            return view_table(table_view, task->get_uuid(), *event_sink,
+                              task_control);
+          });
+      // the stream's client gets the reason with the DONE event
+      std::string error_message = response->get_error_message().value_or("");
+      finish_task(*task, std::move(response), event_sink,
+                  std::move(error_message), counters, responseQueue);
+      break;
+    }
+    case TaskType::CPP_MANAGEMENT_TASK: {
+      const CppManagementPayload &command =
+          std::get<CppManagementPayload>(task->get_data());
+
+      // probes, no time limit and no R code to interrupt
+      std::unique_ptr<RResponse> response = run_task(
+          *task, task_control, std::chrono::milliseconds::zero(),
+          ManagementTaskResultPayload{}, [&] {
+            return run_cpp_command(command, task->get_uuid(), counters);
+          });
+      std::string done_content = management_done_content(*response);
+      finish_task(*task, std::move(response), event_sink,
+                  std::move(done_content), counters, responseQueue);
+      break;
+    }
+    default:
+      // should be unreachable
+      CHECK(false) << "RTask of unknown type";
+      break;
+    }
+  }
 }
 
 } // namespace RWorker
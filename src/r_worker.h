@@ -2,15 +2,31 @@
 
 #include "r_result.h"
 #include "r_task.h"
+#include <blockingconcurrentqueue.h>
 #include <concurrentqueue.h>
 #include <memory>
+#include <stop_token>
 
 namespace RWorker {
 using namespace moodycamel;
-void r_worker_thread(
-    std::stop_token stop_token,
-    ConcurrentQueue<std::unique_ptr<RTask>> &taskQueue,
-    ConcurrentQueue<std::unique_ptr<RResponse>> &responseQueue);
+// starts the embedded R interpreter and runs the RSetup snippets. R is tied
+// to the thread that calls this, everything R related has to happen on it
+void init_embedded_R();
+
+class PlotRenderPool;
+class RTaskControl;
+class RTaskScheduler;
+
+// executes tasks until the stop token is set, R must already be initialized
+// on the calling thread. runs inside each R worker process
+// (see r_worker_process.h). tasks are taken in the order scheduler picks
+// (r_task_scheduler.h). tasks cancelled through task_control are skipped
+// or interrupted (r_task_control.h), plots go to render_pool if set
+// (r_plot_render.h)
+void r_worker_loop(
+    std::stop_token stop_token, RTaskScheduler &scheduler,
+    BlockingConcurrentQueue<std::unique_ptr<RResponse>> &responseQueue,
+    RTaskControl &task_control, PlotRenderPool *render_pool = nullptr);
 
 extern bool is_R_init;
 } // namespace RWorker
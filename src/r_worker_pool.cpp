@@ -0,0 +1,451 @@
+#include "r_worker_pool.h"
+#include "r_ipc.h"
+
+#include <absl/log/check.h>
+#include <absl/log/log.h>
+
+#include <algorithm>
+#include <chrono>
+#include <exception>
+#include <optional>
+#include <stdexcept>
+#include <sys/socket.h>
+#include <unistd.h>
+
+namespace RWorker {
+
+namespace {
+
+// how often worker_for_session() looks for idle sessions, a pin may outlive
+// its timeout by up to this much
+constexpr std::chrono::seconds session_expiry_interval(60);
+
+} // namespace
+
+RWorkerPool::RWorkerPool(std::size_t min_workers, std::size_t max_workers,
+                         std::size_t render_helpers,
+                         std::chrono::seconds session_idle_timeout)
+    : zygote_(render_helpers), max_workers_(std::max(min_workers, max_workers)),
+      session_idle_timeout_(session_idle_timeout) {
+  CHECK(min_workers > 0) << "RWorkerPool needs at least one worker";
+
+  for (std::size_t i = 0; i < min_workers; ++i) {
+    std::unique_ptr<Worker> worker = spawn_worker();
+    if (worker == nullptr) {
+      throw std::runtime_error("RWorkerPool: could not spawn R workers");
+    }
+    std::lock_guard<std::mutex> lock(pool_mutex_);
+    add_worker(std::move(worker));
+  }
+}
+
+RWorkerPool::~RWorkerPool() {
+  std::vector<Worker *> workers;
+  {
+    std::lock_guard<std::mutex> lock(pool_mutex_);
+    for (std::unique_ptr<Worker> &worker : workers_) {
+      // wakes the reader thread out of recv() and gives the worker its EOF
+      worker->reader.request_stop();
+      shutdown(worker->socket_fd, SHUT_RDWR);
+      workers.push_back(worker.get());
+    }
+  }
+
+  // joined without pool_mutex_, a reader that saw its worker die before the
+  // stop needs it for unpin_sessions(). the workers are the zygote's
+  // children, it reaps them
+  for (Worker *worker : workers) {
+    if (worker->reader.joinable()) {
+      worker->reader.join();
+    }
+    close(worker->socket_fd);
+  }
+}
+
+void RWorkerPool::start(
+    moodycamel::BlockingConcurrentQueue<std::unique_ptr<RResponse>>
+        &response_queue) {
+  std::lock_guard<std::mutex> lock(pool_mutex_);
+  response_queue_ = &response_queue;
+
+  for (std::unique_ptr<Worker> &worker : workers_) {
+    start_reader(*worker);
+  }
+}
+
+void RWorkerPool::start_reader(Worker &worker) {
+  worker.reader = std::jthread([this, &worker](std::stop_token stop_token) {
+    read_worker_frames(stop_token, worker);
+  });
+}
+
+std::unique_ptr<RWorkerPool::Worker> RWorkerPool::spawn_worker() {
+  auto spawn_start = std::chrono::steady_clock::now();
+
+  // RZygote serializes concurrent spawns itself
+  std::optional<SpawnedWorker> spawned = zygote_.spawn_worker();
+  if (!spawned.has_value()) {
+    LOG(ERROR) << "RWorkerPool: zygote " << zygote_.pid()
+               << " failed to spawn an R worker";
+    return nullptr;
+  }
+
+  auto worker = std::make_unique<Worker>();
+  worker->pid = spawned->pid;
+  worker->socket_fd = spawned->socket_fd;
+
+  auto spawn_ms = std::chrono::duration_cast<std::chrono::milliseconds>(
+      std::chrono::steady_clock::now() - spawn_start);
+  LOG(INFO) << "RWorkerPool: spawned R worker process " << worker->pid
+            << " in " << spawn_ms.count() << "ms";
+  return worker;
+}
+
+RWorkerPool::Worker *RWorkerPool::add_worker(std::unique_ptr<Worker> worker) {
+  Worker *worker_ptr = worker.get();
+  workers_.push_back(std::move(worker));
+
+  // only spawns after start() need their reader started here
+  if (response_queue_ != nullptr) {
+    start_reader(*worker_ptr);
+  }
+  return worker_ptr;
+}
+
+void RWorkerPool::submit(std::unique_ptr<RTask> task) {
+  Worker &worker = worker_for_session(task->get_session_id());
+
+  std::string task_uuid = task->get_uuid();
+  std::shared_ptr<OutputEventSink> event_sink = task->get_event_sink();
+  std::string payload = serialize_task(*task);
+
+  {
+    std::lock_guard<std::mutex> lock(worker.state_mutex);
+    if (worker.alive) {
+      worker.in_flight.emplace(
+          task_uuid, InFlightTask{task->get_session_id(), task->get_type()});
+      if (event_sink) {
+        worker.event_sinks[task_uuid] = event_sink;
+      }
+    }
+  }
+
+  bool written = false;
+  {
+    std::lock_guard<std::mutex> lock(worker.write_mutex);
+    written = write_frame(worker.socket_fd, FrameType::TASK, payload);
+  }
+
+  if (!written) {
+    {
+      std::lock_guard<std::mutex> lock(worker.state_mutex);
+      worker.in_flight.erase(task_uuid);
+      worker.event_sinks.erase(task_uuid);
+    }
+    if (event_sink) {
+      event_sink->push_event(OutputEvent{
+          OutputEventType::DONE, "", ResponseStatus::FAILURE_TASK_EXECUTION});
+    }
+    fail_task(task_uuid, task->get_type(), "R worker process is not running");
+  }
+}
+
+bool RWorkerPool::cancel(const std::string &task_uuid) {
+  return send_task_control(FrameType::CANCEL, task_uuid, task_uuid);
+}
+
+bool RWorkerPool::abandon(const std::string &task_uuid) {
+  return send_task_control(FrameType::ABANDON, task_uuid, task_uuid);
+}
+
+bool RWorkerPool::grant_credit(const std::string &task_uuid, uint64_t bytes) {
+  return send_task_control(FrameType::CREDIT, task_uuid,
+                           serialize_credit(task_uuid, bytes));
+}
+
+bool RWorkerPool::send_task_control(FrameType type,
+                                    const std::string &task_uuid,
+                                    std::string_view payload) {
+  Worker *owner = nullptr;
+  {
+    std::lock_guard<std::mutex> pool_lock(pool_mutex_);
+    for (std::unique_ptr<Worker> &worker : workers_) {
+      std::lock_guard<std::mutex> lock(worker->state_mutex);
+      if (worker->alive && worker->in_flight.contains(task_uuid)) {
+        owner = worker.get();
+        break;
+      }
+    }
+  }
+  if (owner == nullptr) {
+    return false;
+  }
+
+  // workers are never removed, the reference stays valid without the lock
+  std::lock_guard<std::mutex> lock(owner->write_mutex);
+  return write_frame(owner->socket_fd, type, payload);
+}
+
+RWorkerPool::Worker *
+RWorkerPool::pinned_worker(const std::string &session_id,
+                           std::chrono::steady_clock::time_point now) {
+  auto it = session_workers_.find(session_id);
+  if (it == session_workers_.end()) {
+    return nullptr;
+  }
+
+  Worker *worker = it->second.worker;
+  {
+    std::lock_guard<std::mutex> lock(worker->state_mutex);
+    if (!worker->alive) {
+      // died, unpin_sessions() is about to drop the pin
+      return nullptr;
+    }
+  }
+  it->second.last_used = now;
+  return worker;
+}
+
+void RWorkerPool::expire_idle_sessions(
+    std::chrono::steady_clock::time_point now) {
+  if (session_idle_timeout_ == std::chrono::seconds::zero() ||
+      now < next_session_expiry_) {
+    return;
+  }
+  next_session_expiry_ = now + session_expiry_interval;
+
+  // sessions with a task in flight aren't idle, however long it runs
+  absl::flat_hash_set<std::string> busy_sessions;
+  for (std::unique_ptr<Worker> &worker : workers_) {
+    std::lock_guard<std::mutex> lock(worker->state_mutex);
+    for (const auto &[task_uuid, task] : worker->in_flight) {
+      busy_sessions.insert(task.session_id);
+    }
+  }
+
+  std::size_t num_expired = 0;
+  for (auto it = session_workers_.begin(); it != session_workers_.end();) {
+    const SessionPin &pin = it->second;
+    if (now - pin.last_used < session_idle_timeout_ ||
+        busy_sessions.contains(it->first)) {
+      ++it;
+      continue;
+    }
+    {
+      std::lock_guard<std::mutex> lock(pin.worker->state_mutex);
+      --pin.worker->num_sessions;
+    }
+    session_workers_.erase(it++);
+    ++num_expired;
+  }
+
+  if (num_expired > 0) {
+    LOG(INFO) << "RWorkerPool: unpinned " << num_expired
+              << " sessions idle for over " << session_idle_timeout_.count()
+              << "s";
+  }
+}
+
+void RWorkerPool::unpin_sessions(Worker &worker) {
+  std::size_t num_unpinned = 0;
+  {
+    std::lock_guard<std::mutex> pool_lock(pool_mutex_);
+    num_unpinned = absl::erase_if(
+        session_workers_,
+        [&worker](const auto &entry) { return entry.second.worker == &worker; });
+  }
+  {
+    std::lock_guard<std::mutex> lock(worker.state_mutex);
+    worker.num_sessions = 0;
+  }
+
+  if (num_unpinned > 0) {
+    // their state died with the worker
+    LOG(WARNING) << "RWorkerPool: " << num_unpinned
+                 << " sessions of R worker process " << worker.pid
+                 << " start over";
+  }
+}
+
+RWorkerPool::Worker &
+RWorkerPool::worker_for_session(const std::string &session_id) {
+  auto now = std::chrono::steady_clock::now();
+  std::unique_lock<std::mutex> pool_lock(pool_mutex_);
+
+  expire_idle_sessions(now);
+
+  // 1. a live worker that has no session pinned to it
+  // 2. a new worker, while under max_workers_
+  // 3. the live worker with the least in-flight tasks, then fewest pinned
+  //    sessions
+  //
+  // the spawn happens without the lock, other sessions keep being placed
+  // meanwhile. its slot is reserved in num_spawning_, and once it is back
+  // everything is looked at again: another task of the same session may
+  // have been placed in the meantime
+  Worker *chosen = nullptr;
+  Worker *spawned = nullptr;
+  bool spawn_failed = false;
+  while (chosen == nullptr) {
+    if (Worker *worker = pinned_worker(session_id, now)) {
+      return *worker;
+    }
+    if (spawned != nullptr) {
+      chosen = spawned;
+      break;
+    }
+
+    Worker *idle = nullptr;
+    Worker *least_loaded = nullptr;
+    std::size_t least_in_flight = 0;
+    std::size_t least_sessions = 0;
+    std::size_t num_alive = 0;
+    for (std::unique_ptr<Worker> &worker : workers_) {
+      std::lock_guard<std::mutex> lock(worker->state_mutex);
+      if (!worker->alive) {
+        continue;
+      }
+      ++num_alive;
+
+      std::size_t in_flight = worker->in_flight.size();
+      if (worker->num_sessions == 0 && idle == nullptr) {
+        idle = worker.get();
+      }
+      if (least_loaded == nullptr || in_flight < least_in_flight ||
+          (in_flight == least_in_flight &&
+           worker->num_sessions < least_sessions)) {
+        least_loaded = worker.get();
+        least_in_flight = in_flight;
+        least_sessions = worker->num_sessions;
+      }
+    }
+
+    if (idle == nullptr && !spawn_failed &&
+        num_alive + num_spawning_ < max_workers_) {
+      ++num_spawning_;
+      pool_lock.unlock();
+      std::unique_ptr<Worker> worker = spawn_worker();
+      pool_lock.lock();
+      --num_spawning_;
+      if (worker != nullptr) {
+        spawned = add_worker(std::move(worker));
+      } else {
+        spawn_failed = true;
+      }
+      continue;
+    }
+
+    chosen = idle != nullptr ? idle : least_loaded;
+    if (chosen == nullptr) {
+      // nothing alive and the zygote can't help, submit() fails the task. not
+      // pinned, the next task of the session tries again
+      return *workers_.front();
+    }
+  }
+
+  {
+    std::lock_guard<std::mutex> lock(chosen->state_mutex);
+    ++chosen->num_sessions;
+  }
+  session_workers_[session_id] = SessionPin{chosen, now};
+
+  LOG(INFO) << "RWorkerPool: session \"" << session_id
+            << "\" assigned to R worker process " << chosen->pid;
+  return *chosen;
+}
+
+void RWorkerPool::read_worker_frames(std::stop_token stop_token,
+                                     Worker &worker) {
+  Frame frame;
+  while (read_frame(worker.socket_fd, frame)) {
+    try {
+      switch (frame.type) {
+      case FrameType::RESPONSE: {
+        std::unique_ptr<RResponse> response =
+            deserialize_response(frame.payload);
+        {
+          // the sink stays until its DONE event, which the worker sends on
+          // another thread and can arrive after the response
+          std::lock_guard<std::mutex> lock(worker.state_mutex);
+          worker.in_flight.erase(response->get_task_uuid());
+        }
+        response_queue_->enqueue(std::move(response));
+        break;
+      }
+      case FrameType::OUTPUT_EVENT: {
+        std::string task_uuid;
+        OutputEvent event = deserialize_output_event(frame.payload, task_uuid);
+
+        std::shared_ptr<OutputEventSink> event_sink;
+        {
+          std::lock_guard<std::mutex> lock(worker.state_mutex);
+          auto it = worker.event_sinks.find(task_uuid);
+          if (it != worker.event_sinks.end()) {
+            event_sink = it->second;
+            if (event.type == OutputEventType::DONE) {
+              worker.event_sinks.erase(it);
+            }
+          }
+        }
+        if (event_sink) {
+          event_sink->push_event(std::move(event));
+        }
+        break;
+      }
+      default:
+        LOG(WARNING) << "RWorkerPool: unexpected frame type "
+                     << static_cast<int>(frame.type) << " from R worker "
+                     << worker.pid;
+        break;
+      }
+    } catch (const std::exception &e) {
+      LOG(ERROR) << "RWorkerPool: malformed frame from R worker " << worker.pid
+                 << ": " << e.what();
+    }
+  }
+
+  if (stop_token.stop_requested()) {
+    return;
+  }
+
+  LOG(ERROR) << "RWorkerPool: lost connection to R worker process "
+             << worker.pid;
+  fail_in_flight(worker, "R worker process exited while running the task");
+  unpin_sessions(worker);
+}
+
+void RWorkerPool::fail_in_flight(Worker &worker, const std::string &reason) {
+  absl::flat_hash_map<std::string, InFlightTask> in_flight;
+  absl::flat_hash_map<std::string, std::shared_ptr<OutputEventSink>>
+      event_sinks;
+  {
+    std::lock_guard<std::mutex> lock(worker.state_mutex);
+    worker.alive = false;
+    in_flight.swap(worker.in_flight);
+    event_sinks.swap(worker.event_sinks);
+  }
+
+  // streams that never got their DONE event, including ones whose response
+  // already made it
+  for (auto &[task_uuid, event_sink] : event_sinks) {
+    event_sink->push_event(OutputEvent{
+        OutputEventType::DONE, "", ResponseStatus::FAILURE_TASK_EXECUTION});
+  }
+  for (const auto &[task_uuid, task] : in_flight) {
+    fail_task(task_uuid, task.type, reason);
+  }
+}
+
+void RWorkerPool::fail_task(const std::string &task_uuid, TaskType type,
+                            const std::string &reason) {
+  if (response_queue_ == nullptr) {
+    return;
+  }
+  auto response = std::make_unique<RResponse>(
+      task_uuid, ResponseStatus::FAILURE_TASK_EXECUTION, std::monostate{},
+      reason);
+  response->set_task_type(type);
+  response_queue_->enqueue(std::move(response));
+}
+
+} // namespace RWorker
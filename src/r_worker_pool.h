@@ -0,0 +1,162 @@
+#pragma once
+
+#include "r_ipc.h"
+#include "r_result.h"
+#include "r_task.h"
+#include "r_zygote.h"
+
+#include <absl/container/flat_hash_map.h>
+#include <absl/container/flat_hash_set.h>
+#include <absl/base/thread_annotations.h>
+#include <blockingconcurrentqueue.h>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <sys/types.h>
+#include <thread>
+#include <vector>
+
+namespace RWorker {
+
+// pool of R worker processes (see r_worker_process.h), the front-end side.
+//
+// workers are forked warm by the zygote (r_zygote.h). the pool starts with
+// min_workers and grows up to max_workers on demand.
+//
+// every session is pinned to one worker, that worker's client_env is the
+// session's state. a session the pool has not seen before goes to a worker
+// without sessions, else to a newly spawned worker while under max_workers,
+// else to the worker with the least tasks in flight. a session whose worker
+// died starts over on another worker, and so does one that had no task for
+// session_idle_timeout, its pin is dropped so it stops counting towards its
+// worker's load. tasks are written straight to the worker's socket, the
+// worker queues them locally.
+//
+// responses come back on one reader thread per worker and go into the shared
+// response queue, same as when R ran on a thread in this process. streaming
+// output is forwarded to the sink the task was submitted with.
+class RWorkerPool {
+public:
+  // forks the zygote and spawns the first workers. fork() and threads do not
+  // mix, so this has to run before anything in the process starts a thread
+  // (gRPC included). every worker gets render_helpers plot render helper
+  // processes, 0 renders plots inline on the worker. a session_idle_timeout
+  // of zero keeps sessions pinned for as long as their worker lives
+  RWorkerPool(std::size_t min_workers, std::size_t max_workers,
+              std::size_t render_helpers,
+              std::chrono::seconds session_idle_timeout =
+                  std::chrono::seconds::zero());
+  ~RWorkerPool();
+
+  RWorkerPool(const RWorkerPool &) = delete;
+  RWorkerPool &operator=(const RWorkerPool &) = delete;
+
+  // starts the reader threads, responses from then on go to response_queue
+  void start(
+      moodycamel::BlockingConcurrentQueue<std::unique_ptr<RResponse>>
+          &response_queue);
+
+  // sends the task to the worker owning its session. if the worker is gone a
+  // FAILURE_TASK_EXECUTION response is queued for it instead
+  void submit(std::unique_ptr<RTask> task);
+
+  // asks the worker the task is on to cancel it (CANCEL frame). the task's
+  // response still comes back as usual, CANCELLED if the worker got to it in
+  // time. false if no live worker has the task in flight
+  bool cancel(const std::string &task_uuid);
+  // tells the worker the task's client went away (ABANDON frame), it is
+  // dropped if it hasn't started yet. false if no live worker has the task
+  // in flight
+  bool abandon(const std::string &task_uuid);
+  // tells the worker the task's client read bytes more of its VIEW_TABLE
+  // stream (CREDIT frame), so that much more of it can be sent. false if no
+  // live worker has the task in flight
+  bool grant_credit(const std::string &task_uuid, uint64_t bytes);
+
+private:
+  // what the pool remembers of a task sent to a worker
+  struct InFlightTask {
+    std::string session_id;
+    // for the failure response if the worker dies
+    TaskType type;
+  };
+
+  struct Worker {
+    pid_t pid = -1;
+    int socket_fd = -1;
+    // serializes frames written by different gRPC threads
+    std::mutex write_mutex;
+
+    std::mutex state_mutex;
+    bool alive ABSL_GUARDED_BY(state_mutex) = true;
+    // by task uuid
+    absl::flat_hash_map<std::string, InFlightTask>
+        in_flight ABSL_GUARDED_BY(state_mutex);
+    absl::flat_hash_map<std::string, std::shared_ptr<OutputEventSink>>
+        event_sinks ABSL_GUARDED_BY(state_mutex);
+    // sessions pinned to it right now, in session_workers_
+    std::size_t num_sessions ABSL_GUARDED_BY(state_mutex) = 0;
+
+    std::jthread reader;
+  };
+
+  struct SessionPin {
+    Worker *worker;
+    // when the session last submitted a task
+    std::chrono::steady_clock::time_point last_used;
+  };
+
+  // picks (and remembers) the worker for a session
+  Worker &worker_for_session(const std::string &session_id);
+  // the live worker the session is pinned to, null if it isn't
+  Worker *pinned_worker(const std::string &session_id,
+                        std::chrono::steady_clock::time_point now)
+      ABSL_EXCLUSIVE_LOCKS_REQUIRED(pool_mutex_);
+  // drops the pins of sessions that have nothing in flight and were last used
+  // more than session_idle_timeout_ ago. looks at most once a minute
+  void expire_idle_sessions(std::chrono::steady_clock::time_point now)
+      ABSL_EXCLUSIVE_LOCKS_REQUIRED(pool_mutex_);
+  // drops the pins of the sessions of a worker that died
+  void unpin_sessions(Worker &worker);
+  // asks the zygote for another worker, null if that failed. waits for the
+  // zygote's fork, don't hold pool_mutex_
+  std::unique_ptr<Worker> spawn_worker();
+  // puts a spawned worker in the pool, starts its reader once start() ran
+  Worker *add_worker(std::unique_ptr<Worker> worker)
+      ABSL_EXCLUSIVE_LOCKS_REQUIRED(pool_mutex_);
+  void start_reader(Worker &worker);
+  void read_worker_frames(std::stop_token stop_token, Worker &worker);
+  // answers every in-flight task of a dead worker with a failure
+  void fail_in_flight(Worker &worker, const std::string &reason);
+  void fail_task(const std::string &task_uuid, TaskType type,
+                 const std::string &reason);
+  // writes a CANCEL/ABANDON/CREDIT frame for task_uuid to the worker that
+  // has it
+  bool send_task_control(FrameType type, const std::string &task_uuid,
+                         std::string_view payload);
+
+  // destroyed after the workers, the zygote's destructor waits for it
+  RZygote zygote_;
+  std::size_t max_workers_;
+  std::chrono::seconds session_idle_timeout_;
+
+  std::mutex pool_mutex_;
+  // never shrinks, dead workers stay in here so references stay valid
+  std::vector<std::unique_ptr<Worker>> workers_ ABSL_GUARDED_BY(pool_mutex_);
+  // workers being spawned without the lock, they count towards max_workers_
+  std::size_t num_spawning_ ABSL_GUARDED_BY(pool_mutex_) = 0;
+  // only sessions of live workers
+  absl::flat_hash_map<std::string, SessionPin>
+      session_workers_ ABSL_GUARDED_BY(pool_mutex_);
+  std::chrono::steady_clock::time_point
+      next_session_expiry_ ABSL_GUARDED_BY(pool_mutex_);
+
+  moodycamel::BlockingConcurrentQueue<std::unique_ptr<RResponse>>
+      *response_queue_ = nullptr;
+};
+
+} // namespace RWorker
@@ -0,0 +1,193 @@
+#include "r_worker_process.h"
+#include "r_ipc.h"
+#include "r_plot_render.h"
+#include "r_result.h"
+#include "r_task.h"
+#include "r_task_control.h"
+#include "r_task_scheduler.h"
+#include "r_worker.h"
+
+#include <blockingconcurrentqueue.h>
+
+#include <chrono>
+#include <exception>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <unistd.h>
+#include <variant>
+
+namespace RWorker {
+
+namespace {
+
+// how long the writer thread blocks before re-checking its stop token
+constexpr std::chrono::milliseconds response_wait_timeout(100);
+
+// forwards a task's streaming output to the front-end. shares the socket with
+// the writer thread, hence the lock
+class IpcOutputEventSink : public OutputEventSink {
+public:
+  IpcOutputEventSink(int socket_fd, std::mutex &write_mutex,
+                     std::string task_uuid)
+      : socket_fd_(socket_fd), write_mutex_(write_mutex),
+        task_uuid_(std::move(task_uuid)) {}
+
+  void push_event(OutputEvent event) override {
+    std::string payload = serialize_output_event(task_uuid_, event);
+    std::lock_guard<std::mutex> lock(write_mutex_);
+    // if the front-end is gone the reader thread notices and stops us
+    write_frame(socket_fd_, FrameType::OUTPUT_EVENT, payload);
+  }
+
+  void push_data_event(OutputEventType type,
+                       const std::vector<std::string_view> &pieces) override {
+    std::lock_guard<std::mutex> lock(write_mutex_);
+    write_output_event_frame(socket_fd_, task_uuid_, type, pieces);
+  }
+
+private:
+  int socket_fd_;
+  std::mutex &write_mutex_;
+  std::string task_uuid_;
+};
+
+void read_tasks(std::stop_source r_loop_stop, int socket_fd,
+                std::mutex &write_mutex,
+                RTaskScheduler &scheduler, RTaskControl &task_control) {
+  Frame frame;
+  while (read_frame(socket_fd, frame)) {
+    if (frame.type == FrameType::CANCEL) {
+      // queued: skipped by the R thread. running: interrupted
+      task_control.cancel(frame.payload);
+      continue;
+    }
+    if (frame.type == FrameType::ABANDON) {
+      task_control.abandon(frame.payload);
+      continue;
+    }
+    if (frame.type == FrameType::CREDIT) {
+      try {
+        std::string task_uuid;
+        uint64_t bytes = deserialize_credit(frame.payload, task_uuid);
+        task_control.add_credit(task_uuid, bytes);
+      } catch (const std::exception &e) {
+        std::cerr << "R worker " << getpid()
+                  << ": dropping malformed credit: " << e.what() << std::endl;
+      }
+      continue;
+    }
+    if (frame.type != FrameType::TASK) {
+      std::cerr << "R worker " << getpid() << ": unexpected frame type "
+                << static_cast<int>(frame.type) << std::endl;
+      continue;
+    }
+
+    try {
+      bool wants_events = false;
+      std::unique_ptr<RTask> task = deserialize_task(frame.payload, wants_events);
+      if (wants_events) {
+        task->set_event_sink(std::make_shared<IpcOutputEventSink>(
+            socket_fd, write_mutex, task->get_uuid()));
+      }
+      task_control.task_queued(task->get_uuid());
+      scheduler.push(std::move(task));
+    } catch (const std::exception &e) {
+      std::cerr << "R worker " << getpid()
+                << ": dropping malformed task: " << e.what() << std::endl;
+    }
+  }
+
+  // front-end closed the socket (or died), nothing left to do
+  r_loop_stop.request_stop();
+}
+
+void write_responses(
+    std::stop_token stop_token, int socket_fd, std::mutex &write_mutex,
+    BlockingConcurrentQueue<std::unique_ptr<RResponse>> &responseQueue) {
+  while (!stop_token.stop_requested()) {
+    std::unique_ptr<RResponse> response;
+    if (!responseQueue.wait_dequeue_timed(response, response_wait_timeout)) {
+      continue;
+    }
+
+    // e.g. a snippet with a lot of big plots, which the output limits don't
+    // cover. the task still has to be answered, its client would wait
+    // forever otherwise
+    if (!response_fits_frame(*response)) {
+      std::cerr << "R worker " << getpid() << ": response of task "
+                << response->get_task_uuid() << " is too big to send"
+                << std::endl;
+      TaskTiming timing = response->get_timing();
+      TaskType task_type = response->get_task_type();
+      response = std::make_unique<RResponse>(
+          response->get_task_uuid(), ResponseStatus::FAILURE_TASK_EXECUTION,
+          std::monostate{},
+          "The task's output was too big to send back from its R worker");
+      response->set_timing(timing);
+      response->set_task_type(task_type);
+    }
+
+    std::lock_guard<std::mutex> lock(write_mutex);
+    if (!write_response_frame(socket_fd, *response)) {
+      // nothing can be sent anymore. going away closes the socket, so the
+      // pool sees EOF and fails the tasks this worker had instead of leaving
+      // them waiting for responses that never come
+      std::cerr << "R worker " << getpid()
+                << ": writing a response failed, exiting" << std::endl;
+      _exit(1);
+    }
+  }
+}
+
+} // namespace
+
+void run_r_worker_process(int socket_fd, std::size_t num_render_helpers) {
+  try {
+    // normally R comes warm from the zygote. R lives on this (the process'
+    // main) thread either way
+    if (!is_R_init) {
+      init_embedded_R();
+    }
+  } catch (const std::exception &e) {
+    std::cerr << "R worker " << getpid()
+              << ": R initialization failed: " << e.what() << std::endl;
+    _exit(1);
+  }
+
+  // forked while this process is still single threaded. the helpers must not
+  // hold on to the front-end socket
+  PlotRenderPool render_pool(num_render_helpers, {socket_fd});
+
+  RTaskScheduler scheduler;
+  BlockingConcurrentQueue<std::unique_ptr<RResponse>> responseQueue;
+  std::mutex write_mutex;
+
+  std::stop_source r_loop_stop;
+  // on this thread, the R thread, interrupts are sent here
+  RTaskControl task_control;
+
+  std::jthread writer(write_responses, socket_fd, std::ref(write_mutex),
+                      std::ref(responseQueue));
+  // the reader blocks in recv(), it is detached instead of joined and simply
+  // goes away with the process
+  std::thread reader(read_tasks, r_loop_stop, socket_fd, std::ref(write_mutex),
+                     std::ref(scheduler), std::ref(task_control));
+  reader.detach();
+
+  r_worker_loop(r_loop_stop.get_token(), scheduler, responseQueue,
+                task_control,
+                render_pool.num_helpers() > 0 ? &render_pool : nullptr);
+
+  // the loop only stops once the front-end is gone, so there is nobody left to
+  // send responses to. leave without running the atexit handlers and static
+  // destructors we inherited through fork(), and without Rf_endEmbeddedR(),
+  // which would delete the R tempdir we share with the zygote. the render
+  // helpers see their sockets close with us and exit on their own
+  writer.request_stop();
+  writer.join();
+  _exit(0);
+}
+
+} // namespace RWorker
@@ -0,0 +1,28 @@
+#pragma once
+
+// entry point of an R worker process
+//
+// the zygote (r_zygote.h) forks one of these per worker, with R already
+// initialized. each one owns its own copy of the embedded R interpreter, and
+// with it its own client_env, and talks to the front-end (RWorkerPool) over a
+// unix socket using the frames from r_ipc.h:
+// - a reader thread turns TASK frames into RTasks on the local task queue
+//   (RTaskScheduler, r_task_scheduler.h, one FIFO per TaskClass),
+//   CANCEL and CREDIT frames go to the RTaskControl (r_task_control.h)
+// - the process' main thread runs r_worker_loop() like the old in-process
+//   R thread did
+// - a writer thread sends RResponses back as RESPONSE frames, streaming
+//   output goes back as OUTPUT_EVENT frames straight from the R thread
+//
+// before any of that, it forks num_render_helpers render helpers
+// (r_plot_render.h) that render its plots in parallel.
+//
+// the process exits when the front-end closes its end of the socket. it does
+// not run R's exit cleanup, the R tempdir belongs to the zygote.
+
+#include <cstddef>
+
+namespace RWorker {
+[[noreturn]] void run_r_worker_process(int socket_fd,
+                                       std::size_t num_render_helpers);
+} // namespace RWorker
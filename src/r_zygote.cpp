@@ -0,0 +1,176 @@
+#include "r_zygote.h"
+#include "r_ipc.h"
+#include "r_worker.h"
+#include "r_worker_process.h"
+
+#include <cerrno>
+#include <csignal>
+#include <cstring>
+#include <exception>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <sys/socket.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include <Rembedded.h>
+
+namespace RWorker {
+
+namespace {
+
+// the zygote's reply to a SPAWN_WORKER frame: the pid as the message body and
+// the worker's socket as SCM_RIGHTS ancillary data. pid -1 (and no fd) means
+// the spawn failed
+bool send_worker_handle(int control_fd, pid_t pid, int worker_fd) {
+  struct iovec iov;
+  iov.iov_base = &pid;
+  iov.iov_len = sizeof(pid);
+
+  struct msghdr msg = {};
+  msg.msg_iov = &iov;
+  msg.msg_iovlen = 1;
+
+  alignas(struct cmsghdr) char control[CMSG_SPACE(sizeof(int))];
+  if (worker_fd >= 0) {
+    msg.msg_control = control;
+    msg.msg_controllen = sizeof(control);
+    struct cmsghdr *cmsg = CMSG_FIRSTHDR(&msg);
+    cmsg->cmsg_level = SOL_SOCKET;
+    cmsg->cmsg_type = SCM_RIGHTS;
+    cmsg->cmsg_len = CMSG_LEN(sizeof(int));
+    std::memcpy(CMSG_DATA(cmsg), &worker_fd, sizeof(int));
+  }
+
+  ssize_t sent;
+  do {
+    sent = sendmsg(control_fd, &msg, MSG_NOSIGNAL);
+  } while (sent < 0 && errno == EINTR);
+  return sent == static_cast<ssize_t>(sizeof(pid));
+}
+
+bool recv_worker_handle(int control_fd, pid_t &pid, int &worker_fd) {
+  struct iovec iov;
+  iov.iov_base = &pid;
+  iov.iov_len = sizeof(pid);
+
+  alignas(struct cmsghdr) char control[CMSG_SPACE(sizeof(int))];
+  struct msghdr msg = {};
+  msg.msg_iov = &iov;
+  msg.msg_iovlen = 1;
+  msg.msg_control = control;
+  msg.msg_controllen = sizeof(control);
+
+  ssize_t got;
+  do {
+    got = recvmsg(control_fd, &msg, MSG_CMSG_CLOEXEC);
+  } while (got < 0 && errno == EINTR);
+  if (got != static_cast<ssize_t>(sizeof(pid))) {
+    return false;
+  }
+
+  worker_fd = -1;
+  for (struct cmsghdr *cmsg = CMSG_FIRSTHDR(&msg); cmsg != nullptr;
+       cmsg = CMSG_NXTHDR(&msg, cmsg)) {
+    if (cmsg->cmsg_level == SOL_SOCKET && cmsg->cmsg_type == SCM_RIGHTS) {
+      std::memcpy(&worker_fd, CMSG_DATA(cmsg), sizeof(int));
+    }
+  }
+  return pid > 0 && worker_fd >= 0;
+}
+
+[[noreturn]] void run_r_zygote(int control_fd,
+                              std::size_t num_render_helpers) {
+  try {
+    init_embedded_R();
+  } catch (const std::exception &e) {
+    std::cerr << "R zygote " << getpid()
+              << ": R initialization failed: " << e.what() << std::endl;
+    _exit(1);
+  }
+
+  // workers are never waited on, let the kernel reap them
+  std::signal(SIGCHLD, SIG_IGN);
+
+  Frame frame;
+  while (read_frame(control_fd, frame)) {
+    if (frame.type != FrameType::SPAWN_WORKER) {
+      std::cerr << "R zygote: unexpected frame type "
+                << static_cast<int>(frame.type) << std::endl;
+      continue;
+    }
+
+    int fds[2];
+    if (socketpair(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0, fds) != 0) {
+      send_worker_handle(control_fd, -1, -1);
+      continue;
+    }
+
+    pid_t pid = fork();
+    if (pid == 0) {
+      // worker: R is already up, inherited from us
+      close(control_fd);
+      close(fds[0]);
+      std::signal(SIGCHLD, SIG_DFL);
+      run_r_worker_process(fds[1], num_render_helpers);
+    }
+
+    close(fds[1]);
+    send_worker_handle(control_fd, pid, pid > 0 ? fds[0] : -1);
+    close(fds[0]);
+  }
+
+  // front-end is gone
+  Rf_endEmbeddedR(0);
+  _exit(0);
+}
+
+} // namespace
+
+RZygote::RZygote(std::size_t num_render_helpers) {
+  int fds[2];
+  if (socketpair(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0, fds) != 0) {
+    throw std::runtime_error(std::string("socketpair() failed: ") +
+                             std::strerror(errno));
+  }
+
+  pid_t pid = fork();
+  if (pid < 0) {
+    throw std::runtime_error(std::string("fork() failed: ") +
+                             std::strerror(errno));
+  }
+
+  if (pid == 0) {
+    close(fds[0]);
+    run_r_zygote(fds[1], num_render_helpers);
+  }
+
+  close(fds[1]);
+  pid_ = pid;
+  control_fd_ = fds[0];
+}
+
+RZygote::~RZygote() {
+  close(control_fd_);
+  waitpid(pid_, nullptr, 0);
+}
+
+std::optional<SpawnedWorker> RZygote::spawn_worker() {
+  std::lock_guard<std::mutex> lock(control_mutex_);
+
+  if (!write_frame(control_fd_, FrameType::SPAWN_WORKER, "")) {
+    return std::nullopt;
+  }
+
+  // the first spawn also waits for the zygote to finish R init
+  pid_t pid = -1;
+  int worker_fd = -1;
+  if (!recv_worker_handle(control_fd_, pid, worker_fd)) {
+    return std::nullopt;
+  }
+
+  return SpawnedWorker{pid, worker_fd};
+}
+
+} // namespace RWorker
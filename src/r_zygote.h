@@ -0,0 +1,53 @@
+#pragma once
+
+#include <cstddef>
+#include <mutex>
+#include <optional>
+#include <sys/types.h>
+
+// fork server for R worker processes
+//
+// R startup plus the RSetup snippets (data.table, ggplot2, dplyr...) takes
+// seconds. the zygote pays for that once: it is forked from the front-end,
+// initializes R, and from then on only forks already-warm R worker processes
+// when asked to. workers share the zygote's pages copy-on-write, so the loaded
+// packages only take memory once across the pool.
+//
+// the zygote stays single threaded so that fork() is always safe in it, and it
+// reaps its workers itself (they are not children of the front-end). workers
+// also share the zygote's R tempdir and exit without R's cleanup, the same
+// way parallel::mcfork children do.
+
+namespace RWorker {
+
+struct SpawnedWorker {
+  pid_t pid;
+  // front-end end of the worker's socket, see r_worker_process.h
+  int socket_fd;
+};
+
+class RZygote {
+public:
+  // forks the zygote, has to run before the front-end starts any threads.
+  // every worker it forks starts num_render_helpers render helpers
+  explicit RZygote(std::size_t num_render_helpers);
+  // closing the control socket makes the zygote exit
+  ~RZygote();
+
+  RZygote(const RZygote &) = delete;
+  RZygote &operator=(const RZygote &) = delete;
+
+  // asks the zygote for a new worker, blocks until it is forked. thread safe.
+  // empty if the zygote is gone or the fork failed
+  std::optional<SpawnedWorker> spawn_worker();
+
+  pid_t pid() const { return pid_; }
+
+private:
+  pid_t pid_ = -1;
+  int control_fd_ = -1;
+  // one spawn request/reply at a time on the control socket
+  std::mutex control_mutex_;
+};
+
+} // namespace RWorker